@@ -0,0 +1,121 @@
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include "../src/queue.h"
+#include "../src/queue_mpmc.h"
+
+// Escalamiento de la cola MPMC contra Queue protegida con un candado global.
+// Con n hilos hay n productores y n consumidores; cada productor inserta OPS datos.
+// Uso: ./bench_mpmc [n_max]   (por defecto, el número de núcleos)
+
+#define OPS 1000000
+
+static Queue locked_queue;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static QueueMPMC* mpmc_queue;
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void* locked_producer(void* arg) {
+    (void)arg;
+    for (int i = 0; i < OPS; ) {
+        pthread_mutex_lock(&lock);
+        bool ok = !queue_is_full(&locked_queue);
+        if (ok) {
+            queue_enqueue(&locked_queue, i++);
+        }
+        pthread_mutex_unlock(&lock);
+        if (!ok) {
+            sched_yield();  // Cede el procesador para no girar si hay menos núcleos que hilos
+        }
+    }
+    return NULL;
+}
+
+static void* locked_consumer(void* arg) {
+    (void)arg;
+    for (int i = 0; i < OPS; ) {
+        pthread_mutex_lock(&lock);
+        bool ok = !queue_is_empty(&locked_queue);
+        if (ok) {
+            queue_dequeue(&locked_queue);
+            i++;
+        }
+        pthread_mutex_unlock(&lock);
+        if (!ok) {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void* mpmc_producer(void* arg) {
+    (void)arg;
+    for (int i = 0; i < OPS; ) {
+        if (queue_mpmc_try_enqueue(mpmc_queue, i)) {
+            i++;
+        } else {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void* mpmc_consumer(void* arg) {
+    (void)arg;
+    Data d;
+    for (int i = 0; i < OPS; ) {
+        if (queue_mpmc_try_dequeue(mpmc_queue, &d)) {
+            i++;
+        } else {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+// Ejecuta n productores y n consumidores y devuelve los segundos transcurridos
+static double run(int n, void* (*producer)(void*), void* (*consumer)(void*)) {
+    pthread_t* threads = (pthread_t*)malloc(2 * n * sizeof(pthread_t));
+    double start = now();
+    for (int t = 0; t < n; t++) {
+        pthread_create(&threads[2 * t], NULL, producer, NULL);
+        pthread_create(&threads[2 * t + 1], NULL, consumer, NULL);
+    }
+    for (int t = 0; t < 2 * n; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    double elapsed = now() - start;
+    free(threads);
+    return elapsed;
+}
+
+int main(int argc, char** argv) {
+    int max_threads = argc > 1 ? atoi(argv[1]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (max_threads < 1) {
+        max_threads = 1;
+    }
+
+    mpmc_queue = queue_mpmc_create();
+    printf("variante,hilos,segundos,ops_por_segundo\n");
+    // Potencias de 2, y al final exactamente max_threads si no es potencia de 2
+    for (int n = 1; n <= max_threads;
+         n = (n < max_threads && n * 2 > max_threads) ? max_threads : n * 2) {
+        locked_queue = queue_create();
+        double locked = run(n, locked_producer, locked_consumer);
+        double mpmc = run(n, mpmc_producer, mpmc_consumer);
+        double ops = 2.0 * n * OPS;  // Cada dato cuenta una inserción y una extracción
+        printf("mutex,%d,%.3f,%.0f\n", n, locked, ops / locked);
+        printf("mpmc,%d,%.3f,%.0f\n", n, mpmc, ops / mpmc);
+    }
+    queue_mpmc_delete(mpmc_queue);
+    return 0;
+}
@@ -0,0 +1,95 @@
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../src/queue.h"
+#include "../src/queue_spsc.h"
+
+// Compara la cola SPSC sin candados contra Queue protegida con un mutex,
+// con un hilo productor y un hilo consumidor.
+
+#define MESSAGES 20000000
+
+static Queue locked_queue;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static QueueSPSC* spsc_queue;
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void* locked_producer(void* arg) {
+    (void)arg;
+    for (int i = 0; i < MESSAGES; ) {
+        pthread_mutex_lock(&lock);
+        bool ok = !queue_is_full(&locked_queue);
+        if (ok) {
+            queue_enqueue(&locked_queue, i++);
+        }
+        pthread_mutex_unlock(&lock);
+        if (!ok) {
+            sched_yield();  // Cede el procesador para no girar si hay menos núcleos que hilos
+        }
+    }
+    return NULL;
+}
+
+static void* spsc_producer(void* arg) {
+    (void)arg;
+    for (int i = 0; i < MESSAGES; ) {
+        if (queue_spsc_try_enqueue(spsc_queue, i)) {
+            i++;
+        } else {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+int main(void) {
+    pthread_t producer;
+    long long sum = 0;
+    double start;
+
+    locked_queue = queue_create();
+    start = now();
+    pthread_create(&producer, NULL, locked_producer, NULL);
+    for (int i = 0; i < MESSAGES; ) {
+        pthread_mutex_lock(&lock);
+        bool ok = !queue_is_empty(&locked_queue);
+        if (ok) {
+            sum += queue_dequeue(&locked_queue);
+            i++;
+        }
+        pthread_mutex_unlock(&lock);
+        if (!ok) {
+            sched_yield();
+        }
+    }
+    pthread_join(producer, NULL);
+    double locked = now() - start;
+
+    spsc_queue = queue_spsc_create();
+    start = now();
+    pthread_create(&producer, NULL, spsc_producer, NULL);
+    for (int i = 0; i < MESSAGES; ) {
+        Data d;
+        if (queue_spsc_try_dequeue(spsc_queue, &d)) {
+            sum += d;
+            i++;
+        } else {
+            sched_yield();
+        }
+    }
+    pthread_join(producer, NULL);
+    double spsc = now() - start;
+    queue_spsc_delete(spsc_queue);
+
+    printf("variante,mensajes,segundos,mensajes_por_segundo\n");
+    printf("mutex,%d,%.3f,%.0f\n", MESSAGES, locked, MESSAGES / locked);
+    printf("spsc,%d,%.3f,%.0f\n", MESSAGES, spsc, MESSAGES / spsc);
+    return sum == 0;
+}
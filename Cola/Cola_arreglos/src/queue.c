@@ -1,71 +1,81 @@
 #include "queue.h"
 #include <stdlib.h>
 #include <stdbool.h>
+#include <string.h>
 
-#define QUEUE_SIZE 100 // Asumimos un tamaño máximo para la cola
-
-// Estructura para la cola
-struct Queue {
-    Data datos[QUEUE_SIZE];  // Arreglo de datos para la cola
-    int head;  // Índice del frente de la cola
-    int tail;  // Índice del final de la cola
-};
+// Versiones normales (no inline) de las operaciones frecuentes
+#ifndef QUEUE_HEADER_ONLY
+#define QUEUE_INLINE
+#include "queue_inline.h"
+#endif
 
 // Crea una nueva cola vacía y la devuelve
 Queue queue_create() {
     Queue q;
-    q.head = -1;  // Inicializamos el índice del frente
-    q.tail = -1;  // Inicializamos el índice del final
+    q.head = 0;  // El frente empieza en la primera casilla del anillo
+    q.tail = 0;  // El siguiente espacio libre también
+    q.len = 0;   // La cola no tiene elementos
+#ifdef QUEUE_STATS
+    q.stats = (QueueStats){0};
+    q.stats.bytes = sizeof(q.datos);
+#endif
     return q;
 }
 
-// Inserta un elemento al final de la cola
-void queue_enqueue(Queue* q, Data d) {
-    if (q->tail == QUEUE_SIZE - 1) {
-        // La cola está llena, no podemos insertar más elementos
-        return;
-    }
-    if (q->head == -1) {
-        q->head = 0;  // Si la cola está vacía, ponemos el primer elemento
+// Inserta varios elementos al final de la cola, en orden. Devuelve cuántos cupieron.
+// Los datos se copian con a lo más dos memcpy: hasta el final del arreglo y desde el inicio.
+int queue_enqueue_n(Queue* q, const Data* in, int n) {
+    if (in == NULL || n <= 0) {
+        return 0;
     }
-    q->tail++;  // Avanzamos el índice del final
-    q->datos[q->tail] = d;  // Insertamos el dato en la cola
+    int count = n < TAM - q->len ? n : TAM - q->len;
+    int first = count < TAM - q->tail ? count : TAM - q->tail;  // Tramo antes de dar la vuelta
+    memcpy(&q->datos[q->tail], in, first * sizeof(Data));
+    memcpy(&q->datos[0], in + first, (count - first) * sizeof(Data));
+    q->tail = (q->tail + count) & QUEUE_MASK;
+    q->len += count;
+    QUEUE_STATS_ENQUEUED(q, count);
+    QUEUE_STATS_ADD(q, rejected, n - count);
+    return count;
 }
 
-// Elimina y devuelve el elemento al frente de la cola
-Data queue_dequeue(Queue* q) {
-    if (queue_is_empty(q)) {
-        // Cola vacía, devolvemos un valor de error
-        Data error; 
-        return error;  // Asegúrate de definir un valor de error si es necesario
-    }
-    Data front = q->datos[q->head];  // Obtenemos el dato al frente
-    q->head++;  // Avanzamos el índice del frente
-    if (q->head > q->tail) {
-        // Si la cola queda vacía, restablecemos los índices
-        q->head = -1;
-        q->tail = -1;
+// Extrae varios elementos del frente de la cola, en orden. Devuelve cuántos se extrajeron.
+// Igual que queue_enqueue_n, usa a lo más dos memcpy.
+int queue_dequeue_n(Queue* q, Data* out, int n) {
+    if (out == NULL || n <= 0) {
+        return 0;
     }
-    return front;  // Devolvemos el dato del frente
+    int count = n < q->len ? n : q->len;
+    int first = count < TAM - q->head ? count : TAM - q->head;  // Tramo antes de dar la vuelta
+    memcpy(out, &q->datos[q->head], first * sizeof(Data));
+    memcpy(out + first, &q->datos[0], (count - first) * sizeof(Data));
+    q->head = (q->head + count) & QUEUE_MASK;
+    q->len -= count;
+    QUEUE_STATS_DEQUEUED(q, count);
+    return count;
 }
 
-// Verifica si la cola está vacía
-bool queue_is_empty(Queue* q) {
-    return q->head == -1;  // Si head es -1, la cola está vacía
+// Vacía la cola, eliminando todos sus elementos
+void queue_empty(Queue* q) {
+    QUEUE_STATS_DEQUEUED(q, q->len);
+    q->head = 0;  // Restablecemos el índice del frente
+    q->tail = 0;  // Restablecemos el índice del final
+    q->len = 0;
 }
 
-// Obtiene el elemento al frente de la cola sin eliminarlo
-Data queue_front(Queue* q) {
-    if (queue_is_empty(q)) {
-        // Cola vacía, devolvemos un valor de error
-        Data error; 
-        return error;  // Asegúrate de definir un valor de error si es necesario
-    }
-    return q->datos[q->head];  // Devolvemos el dato al frente
+// Elimina la cola; como el arreglo es parte de la estructura solo la dejamos vacía
+void queue_delete(Queue* q) {
+    queue_empty(q);
 }
 
-// Vacía la cola, eliminando todos sus elementos
-void queue_empty(Queue* q) {
-    q->head = -1;  // Restablecemos el índice del frente
-    q->tail = -1;  // Restablecemos el índice del final
+#ifdef QUEUE_STATS
+// Devuelve una copia de las estadísticas de uso de la cola (todas en 0 si q es NULL).
+// Los elementos actuales son enqueues - dequeues; high_water cerca de TAM indica que la cola
+// estuvo a punto de llenarse.
+QueueStats queue_stats(const Queue* q) {
+    if (q == NULL) {
+        return (QueueStats){0};
+    }
+    return q->stats;
 }
+#endif
@@ -2,27 +2,95 @@
 #define __QUEUE_H__
 
 #include <stdbool.h>
+#include <stddef.h>
 
 // Definimos el tipo de dato que usaremos para almacenar los elementos en la cola
 typedef int Data;
 typedef int data;
-#define TAM 100  // Tamaño máximo de la cola
+#define TAM 128  // Capacidad de la cola, debe ser potencia de dos
+#define QUEUE_MASK (TAM - 1)  // Máscara para envolver los índices del anillo
+#define CACHE_LINE 64  // Tamaño de una línea de caché, usado por las variantes concurrentes
 
-// Definimos la estructura de la cola
+// La capacidad debe ser potencia de dos para poder envolver los índices con una máscara
+typedef char queue_tam_potencia_de_dos[(TAM > 0 && (TAM & (TAM - 1)) == 0) ? 1 : -1];
+
+// Estadísticas de uso: al compilar con -DQUEUE_STATS cada cola lleva estos contadores y
+// queue_stats devuelve una copia. Sin la bandera la estructura no cambia y los macros
+// QUEUE_STATS_* no generan código.
+#ifdef QUEUE_STATS
+typedef struct {
+    unsigned long enqueues;    // Elementos insertados
+    unsigned long dequeues;    // Elementos que salieron de la cola (dequeue o vaciado)
+    unsigned long rejected;    // Inserciones descartadas porque la cola estaba llena
+    unsigned long grows;       // Veces que creció la capacidad (siempre 0: es fija)
+    unsigned long allocs;      // Reservas de memoria (siempre 0: el arreglo es parte de Queue)
+    size_t bytes;              // Bytes que ocupa el arreglo de datos
+    unsigned long high_water;  // Máximo de elementos guardados a la vez
+} QueueStats;
+
+#define QUEUE_STATS_ADD(q, field, n) ((q)->stats.field += (n))
+#define QUEUE_STATS_ENQUEUED(q, n) queue_stats_enqueued(&(q)->stats, (n))
+#define QUEUE_STATS_DEQUEUED(q, n) ((q)->stats.dequeues += (n))
+
+// Cuenta n inserciones y actualiza el máximo de elementos (enqueues - dequeues)
+static inline void queue_stats_enqueued(QueueStats* st, unsigned long n) {
+    st->enqueues += n;
+    if (st->enqueues - st->dequeues > st->high_water) {
+        st->high_water = st->enqueues - st->dequeues;
+    }
+}
+#else
+#define QUEUE_STATS_ADD(q, field, n) ((void)0)
+#define QUEUE_STATS_ENQUEUED(q, n) ((void)0)
+#define QUEUE_STATS_DEQUEUED(q, n) ((void)0)
+#endif
+
+// Definimos la estructura de la cola (buffer circular)
 typedef struct {
     Data datos[TAM];  // Arreglo de datos para almacenar los elementos de la cola
     int head;          // Índice para el primer elemento de la cola
     int tail;          // Índice para el siguiente espacio disponible en la cola
     int len;           // Longitud actual de la cola
+#ifdef QUEUE_STATS
+    QueueStats stats;
+#endif
 } Queue;
 
 // Funciones que se implementarán para trabajar con la cola
 Queue queue_create();
+int queue_enqueue_n(Queue*, const Data*, int);
+int queue_dequeue_n(Queue*, Data*, int);
+void queue_empty(Queue*);
+void queue_delete(Queue*);
+#ifdef QUEUE_STATS
+QueueStats queue_stats(const Queue*);
+#endif
+
+// Búsquedas y reducciones sobre los datos de la cola (queue_simd.c). Recorren los dos tramos
+// del anillo con AVX2 o SSE4.1 si el procesador las tiene; queue_simd_use permite fijar el nivel.
+typedef enum {
+    QUEUE_SIMD_SCALAR,
+    QUEUE_SIMD_SSE4,
+    QUEUE_SIMD_AVX2
+} QueueSimdLevel;
+
+int queue_find(const Queue*, Data);
+int queue_count(const Queue*, Data);
+long long queue_sum(const Queue*);
+bool queue_min(const Queue*, Data*);
+QueueSimdLevel queue_simd_use(QueueSimdLevel);
+
+// Operaciones frecuentes: con -DQUEUE_HEADER_ONLY se definen como static inline en queue_inline.h
+#ifdef QUEUE_HEADER_ONLY
+#define QUEUE_INLINE static inline
+#include "queue_inline.h"
+#else
 void queue_enqueue(Queue*, Data);
 Data queue_dequeue(Queue*);
+bool queue_try_dequeue(Queue*, Data*);
 bool queue_is_empty(Queue*);
+bool queue_is_full(Queue*);
 Data queue_front(Queue*);
-void queue_empty(Queue*);
-void queue_delete(Queue*);
+#endif
 
 #endif // __QUEUE_H__
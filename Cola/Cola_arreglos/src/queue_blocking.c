@@ -0,0 +1,146 @@
+#define _POSIX_C_SOURCE 200809L  // pthread_condattr_setclock, clock_gettime
+#include "queue_blocking.h"
+#include <errno.h>
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * Crea una nueva cola bloqueante vacía.
+ *
+ * @return Un apuntador a la cola creada. Si la creación falla, devuelve NULL.
+ * @details Las variables de condición miden los plazos con CLOCK_MONOTONIC, para que un cambio
+ *          de la hora del sistema no alargue ni acorte las esperas.
+ */
+QueueBlocking* queue_blocking_create(void) {
+    QueueBlocking* b = (QueueBlocking*)malloc(sizeof(QueueBlocking));
+    if (b == NULL) {
+        return NULL;
+    }
+
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_mutex_init(&b->lock, NULL);
+    pthread_cond_init(&b->not_empty, &attr);
+    pthread_cond_init(&b->not_full, &attr);
+    pthread_condattr_destroy(&attr);
+
+    b->waiting_consumers = 0;
+    b->waiting_producers = 0;
+    b->q = queue_create();
+    return b;
+}
+
+/**
+ * Calcula el instante absoluto (CLOCK_MONOTONIC) en que vence un plazo de timeout_ms.
+ */
+static struct timespec queue_deadline(long timeout_ms) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    t.tv_sec += timeout_ms / 1000;
+    t.tv_nsec += (timeout_ms % 1000) * 1000000L;
+    if (t.tv_nsec >= 1000000000L) {
+        t.tv_sec++;
+        t.tv_nsec -= 1000000000L;
+    }
+    return t;
+}
+
+/**
+ * Espera en cond, con b->lock tomado, hasta que ready sea verdadera o venza el plazo.
+ *
+ * @param b Apuntador a la cola; el llamante tiene tomado b->lock.
+ * @param cond Variable de condición en la que se duerme.
+ * @param waiting Contador de hilos dormidos en cond.
+ * @param ready Función que indica si ya se puede continuar.
+ * @param timeout_ms Milisegundos máximos de espera; negativo espera sin límite, 0 no espera.
+ * @return `true` si ready se cumplió, `false` si venció el plazo.
+ */
+static bool queue_wait_until(QueueBlocking* b, pthread_cond_t* cond, int* waiting,
+                             bool (*ready)(Queue*), long timeout_ms) {
+    if (ready(&b->q)) {
+        return true;
+    }
+    if (timeout_ms == 0) {
+        return false;
+    }
+
+    struct timespec deadline = queue_deadline(timeout_ms > 0 ? timeout_ms : 0);
+    (*waiting)++;
+    while (!ready(&b->q)) {
+        if (timeout_ms < 0) {
+            pthread_cond_wait(cond, &b->lock);
+        } else if (pthread_cond_timedwait(cond, &b->lock, &deadline) == ETIMEDOUT) {
+            break;
+        }
+    }
+    (*waiting)--;
+    return ready(&b->q);
+}
+
+static bool queue_has_room(Queue* q) {
+    return !queue_is_full(q);
+}
+
+static bool queue_has_data(Queue* q) {
+    return !queue_is_empty(q);
+}
+
+/**
+ * Inserta un elemento al final de la cola, esperando si está llena.
+ *
+ * @param b Apuntador a la cola.
+ * @param d Dato que se insertará.
+ * @param timeout_ms Milisegundos máximos de espera; negativo espera sin límite, 0 no espera.
+ * @return `true` si el dato se insertó, `false` si la cola siguió llena hasta vencer el plazo.
+ * @details Solo se despierta a un consumidor si hay alguno esperando.
+ */
+bool queue_enqueue_wait(QueueBlocking* b, Data d, long timeout_ms) {
+    pthread_mutex_lock(&b->lock);
+    bool ok = queue_wait_until(b, &b->not_full, &b->waiting_producers, queue_has_room, timeout_ms);
+    if (ok) {
+        queue_enqueue(&b->q, d);
+        if (b->waiting_consumers > 0) {
+            pthread_cond_signal(&b->not_empty);
+        }
+    }
+    pthread_mutex_unlock(&b->lock);
+    return ok;
+}
+
+/**
+ * Extrae el elemento al frente de la cola, esperando si está vacía.
+ *
+ * @param b Apuntador a la cola.
+ * @param out Donde se guarda el dato extraído.
+ * @param timeout_ms Milisegundos máximos de espera; negativo espera sin límite, 0 no espera.
+ * @return `true` si se extrajo un dato, `false` si la cola siguió vacía hasta vencer el plazo.
+ * @details Solo se despierta a un productor si hay alguno esperando.
+ */
+bool queue_dequeue_wait(QueueBlocking* b, Data* out, long timeout_ms) {
+    pthread_mutex_lock(&b->lock);
+    bool ok = queue_wait_until(b, &b->not_empty, &b->waiting_consumers, queue_has_data, timeout_ms);
+    if (ok) {
+        *out = queue_dequeue(&b->q);
+        if (b->waiting_producers > 0) {
+            pthread_cond_signal(&b->not_full);
+        }
+    }
+    pthread_mutex_unlock(&b->lock);
+    return ok;
+}
+
+/**
+ * Elimina la cola y libera la memoria asociada a ella.
+ *
+ * @param b Apuntador a la cola. Ningún hilo debe estar esperando en ella.
+ */
+void queue_blocking_delete(QueueBlocking* b) {
+    if (b == NULL) {
+        return;
+    }
+    pthread_cond_destroy(&b->not_full);
+    pthread_cond_destroy(&b->not_empty);
+    pthread_mutex_destroy(&b->lock);
+    free(b);
+}
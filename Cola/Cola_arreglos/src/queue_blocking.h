@@ -0,0 +1,28 @@
+#ifndef __QUEUE_BLOCKING_H__
+#define __QUEUE_BLOCKING_H__
+
+#include <pthread.h>
+#include <stdbool.h>
+#include "queue.h"
+
+// Cola acotada para varios hilos en la que los consumidores pueden dormir hasta que haya datos
+// y los productores hasta que haya espacio, en lugar de girar sobre queue_is_empty.
+// Es una Queue protegida por un mutex; los hilos que esperan se anotan en waiting_* y duermen
+// en una variable de condición. Quien inserta o extrae solo despierta (pthread_cond_signal)
+// si hay alguien anotado, así que sin esperas el camino normal no hace llamadas al sistema:
+// el mutex de glibc sin contención se toma y se suelta con operaciones atómicas.
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t not_empty;  // Aquí esperan los consumidores
+    pthread_cond_t not_full;   // Aquí esperan los productores
+    int waiting_consumers;     // Consumidores dormidos en not_empty
+    int waiting_producers;     // Productores dormidos en not_full
+    Queue q;
+} QueueBlocking;
+
+QueueBlocking* queue_blocking_create(void);
+bool queue_enqueue_wait(QueueBlocking*, Data, long timeout_ms);
+bool queue_dequeue_wait(QueueBlocking*, Data*, long timeout_ms);
+void queue_blocking_delete(QueueBlocking*);
+
+#endif // __QUEUE_BLOCKING_H__
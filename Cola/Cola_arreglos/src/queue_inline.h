@@ -0,0 +1,70 @@
+#ifndef __QUEUE_INLINE_H__
+#define __QUEUE_INLINE_H__
+
+// Operaciones frecuentes de la cola. Este archivo no se incluye directamente:
+// queue.h lo incluye con QUEUE_INLINE = static inline cuando se compila con -DQUEUE_HEADER_ONLY,
+// para que el compilador pueda integrarlas en el código que las llama, y queue.c lo incluye
+// con QUEUE_INLINE vacío para generar las versiones normales.
+
+// Verifica si la cola está vacía
+QUEUE_INLINE bool queue_is_empty(Queue* q) {
+    return q->len == 0;
+}
+
+// Verifica si la cola está llena, es decir, si todas las casillas del anillo están ocupadas
+QUEUE_INLINE bool queue_is_full(Queue* q) {
+    return q->len == TAM;
+}
+
+// Inserta un elemento al final de la cola
+QUEUE_INLINE void queue_enqueue(Queue* q, Data d) {
+    if (queue_is_full(q)) {
+        // La cola está llena, no podemos insertar más elementos
+        QUEUE_STATS_ADD(q, rejected, 1);
+        return;
+    }
+    q->datos[q->tail] = d;  // Insertamos el dato en el siguiente espacio libre
+    q->tail = (q->tail + 1) & QUEUE_MASK;  // Avanzamos el final dando la vuelta al anillo
+    q->len++;
+    QUEUE_STATS_ENQUEUED(q, 1);
+}
+
+// Elimina y devuelve el elemento al frente de la cola
+QUEUE_INLINE Data queue_dequeue(Queue* q) {
+    if (queue_is_empty(q)) {
+        // Cola vacía, devolvemos un valor de error
+        Data error = -1;
+        return error;
+    }
+    Data front = q->datos[q->head];  // Obtenemos el dato al frente
+    q->head = (q->head + 1) & QUEUE_MASK;  // Avanzamos el frente dando la vuelta al anillo
+    q->len--;
+    QUEUE_STATS_DEQUEUED(q, 1);
+    return front;  // Devolvemos el dato del frente
+}
+
+// Obtiene el elemento al frente de la cola sin eliminarlo
+QUEUE_INLINE Data queue_front(Queue* q) {
+    if (queue_is_empty(q)) {
+        // Cola vacía, devolvemos un valor de error
+        Data error = -1;
+        return error;
+    }
+    return q->datos[q->head];  // Devolvemos el dato al frente
+}
+
+// Intenta extraer el elemento al frente de la cola; devuelve false si está vacía (out no cambia).
+// No hay un valor de error que se confunda con un dato, así que no hace falta llamar antes a
+// queue_is_empty: la cola se revisa una sola vez
+QUEUE_INLINE bool queue_try_dequeue(Queue* q, Data* out) {
+    if (queue_is_empty(q)) {
+        return false;
+    }
+    *out = q->datos[q->head];
+    q->head = (q->head + 1) & QUEUE_MASK;
+    q->len--;
+    QUEUE_STATS_DEQUEUED(q, 1);
+    return true;
+}
+
+#endif // __QUEUE_INLINE_H__
@@ -0,0 +1,96 @@
+#include "queue_mpmc.h"
+#include <stdlib.h>
+
+/**
+ * Crea una nueva cola MPMC vacía.
+ * 
+ * @return Un apuntador a la cola creada, alineado a CACHE_LINE. Si la creación falla, devuelve NULL.
+ * @details La casilla i empieza con secuencia i, lo que indica que está libre para la
+ *          escritura número i.
+ */
+QueueMPMC* queue_mpmc_create(void) {
+    QueueMPMC* q = (QueueMPMC*)aligned_alloc(CACHE_LINE, sizeof(QueueMPMC));
+    if (q == NULL) {
+        return NULL;
+    }
+    for (unsigned int i = 0; i < TAM; i++) {
+        atomic_init(&q->slots[i].seq, i);
+    }
+    atomic_init(&q->tail, 0);
+    atomic_init(&q->head, 0);
+    return q;
+}
+
+/**
+ * Intenta insertar un elemento al final de la cola. Puede llamarse desde cualquier hilo.
+ * 
+ * @param q Apuntador a la cola.
+ * @param d Dato que se insertará.
+ * @return `true` si el dato se insertó, `false` si la cola estaba llena. Nunca bloquea.
+ * @details El productor reserva la posición pos con un CAS sobre tail cuando la secuencia de
+ *          la casilla vale pos. Después escribe el dato y publica la casilla con secuencia pos + 1.
+ */
+bool queue_mpmc_try_enqueue(QueueMPMC* q, Data d) {
+    unsigned int pos = atomic_load_explicit(&q->tail, memory_order_relaxed);
+    QueueMPMCSlot* slot;
+    for (;;) {
+        slot = &q->slots[pos & QUEUE_MASK];
+        unsigned int seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        int diff = (int)(seq - pos);
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&q->tail, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                break;  // La posición pos es nuestra
+            }
+        } else if (diff < 0) {
+            return false;  // La casilla aún no se consume: la cola está llena
+        } else {
+            pos = atomic_load_explicit(&q->tail, memory_order_relaxed);  // Otro productor avanzó
+        }
+    }
+    slot->data = d;
+    atomic_store_explicit(&slot->seq, pos + 1, memory_order_release);
+    return true;
+}
+
+/**
+ * Intenta eliminar el elemento al frente de la cola. Puede llamarse desde cualquier hilo.
+ * 
+ * @param q Apuntador a la cola.
+ * @param out Apuntador donde se guarda el dato extraído.
+ * @return `true` si se extrajo un dato, `false` si la cola estaba vacía. Nunca bloquea.
+ * @details El consumidor reserva la posición pos con un CAS sobre head cuando la secuencia de
+ *          la casilla vale pos + 1. Después lee el dato y deja la casilla libre para la siguiente
+ *          vuelta con secuencia pos + TAM.
+ */
+bool queue_mpmc_try_dequeue(QueueMPMC* q, Data* out) {
+    unsigned int pos = atomic_load_explicit(&q->head, memory_order_relaxed);
+    QueueMPMCSlot* slot;
+    for (;;) {
+        slot = &q->slots[pos & QUEUE_MASK];
+        unsigned int seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        int diff = (int)(seq - (pos + 1));
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&q->head, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                break;  // La posición pos es nuestra
+            }
+        } else if (diff < 0) {
+            return false;  // La casilla aún no se escribe: la cola está vacía
+        } else {
+            pos = atomic_load_explicit(&q->head, memory_order_relaxed);  // Otro consumidor avanzó
+        }
+    }
+    *out = slot->data;
+    atomic_store_explicit(&slot->seq, pos + TAM, memory_order_release);
+    return true;
+}
+
+/**
+ * Elimina la cola y libera la memoria asociada a ella.
+ * 
+ * @param q Apuntador a la cola. Ningún hilo debe seguir usándola.
+ */
+void queue_mpmc_delete(QueueMPMC* q) {
+    free(q);
+}
@@ -0,0 +1,27 @@
+#ifndef __QUEUE_MPMC_H__
+#define __QUEUE_MPMC_H__
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include "queue.h"
+
+// Casilla de la cola MPMC: el número de secuencia indica de quién es el turno sobre data
+typedef struct {
+    atomic_uint seq;
+    Data data;
+} QueueMPMCSlot;
+
+// Cola circular acotada para varios productores y varios consumidores, sin candados
+// (algoritmo de D. Vyukov). Los productores solo compiten por tail y los consumidores por head.
+typedef struct {
+    _Alignas(CACHE_LINE) atomic_uint tail;          // Siguiente posición a escribir
+    _Alignas(CACHE_LINE) atomic_uint head;          // Siguiente posición a leer
+    _Alignas(CACHE_LINE) QueueMPMCSlot slots[TAM];  // Casillas contiguas, misma capacidad que Queue
+} QueueMPMC;
+
+QueueMPMC* queue_mpmc_create(void);
+bool queue_mpmc_try_enqueue(QueueMPMC*, Data);
+bool queue_mpmc_try_dequeue(QueueMPMC*, Data*);
+void queue_mpmc_delete(QueueMPMC*);
+
+#endif // __QUEUE_MPMC_H__
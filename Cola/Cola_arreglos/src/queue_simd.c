@@ -0,0 +1,73 @@
+#include "queue.h"
+#include "simd_kernels.h"
+
+static const SimdKernels* kernels = NULL;  // Juego de recorridos elegido; NULL hasta el primer uso
+
+// Fija el nivel de instrucciones de las búsquedas y reducciones. Si el procesador no tiene el
+// nivel pedido se usa el más alto disponible; devuelve el nivel que quedó en uso. No hace falta
+// llamarla: en el primer uso se elige el más alto disponible
+QueueSimdLevel queue_simd_use(QueueSimdLevel level) {
+    int max = simd_cpu_level();
+    if ((int)level > max) {
+        level = (QueueSimdLevel)max;
+    }
+    kernels = simd_kernels_for(level);
+    return level;
+}
+
+// Juego de recorridos en uso; lo elige la primera vez que se necesita
+static const SimdKernels* queue_kernels(void) {
+    if (kernels == NULL) {
+        queue_simd_use(QUEUE_SIMD_AVX2);
+    }
+    return kernels;
+}
+
+// Largo del primer tramo del anillo, de head hasta el final del arreglo (o hasta el último dato).
+// El segundo tramo, si existe, empieza en datos[0] y mide q->len menos este largo
+static int queue_first_run(const Queue* q) {
+    return q->len < TAM - q->head ? q->len : TAM - q->head;
+}
+
+// Busca un dato sin extraer nada. Devuelve su posición contando desde el frente (0 es el frente),
+// o -1 si no está en la cola
+int queue_find(const Queue* q, Data d) {
+    const SimdKernels* k = queue_kernels();
+    int first = queue_first_run(q);
+    int i = k->find(&q->datos[q->head], first, d);
+    if (i >= 0) {
+        return i;
+    }
+    i = k->find(q->datos, q->len - first, d);
+    return i < 0 ? -1 : first + i;
+}
+
+// Cuenta cuántos elementos de la cola son iguales a d
+int queue_count(const Queue* q, Data d) {
+    const SimdKernels* k = queue_kernels();
+    int first = queue_first_run(q);
+    return k->count(&q->datos[q->head], first, d) + k->count(q->datos, q->len - first, d);
+}
+
+// Suma los elementos de la cola, acumulando en 64 bits para que no se desborde
+long long queue_sum(const Queue* q) {
+    const SimdKernels* k = queue_kernels();
+    int first = queue_first_run(q);
+    return k->sum(&q->datos[q->head], first) + k->sum(q->datos, q->len - first);
+}
+
+// Guarda en out el menor elemento de la cola. Devuelve false si está vacía (out no cambia)
+bool queue_min(const Queue* q, Data* out) {
+    if (q->len == 0) {
+        return false;
+    }
+    const SimdKernels* k = queue_kernels();
+    int first = queue_first_run(q);
+    Data min = k->min(&q->datos[q->head], first);
+    if (q->len > first) {
+        Data rest = k->min(q->datos, q->len - first);
+        min = rest < min ? rest : min;
+    }
+    *out = min;
+    return true;
+}
@@ -0,0 +1,73 @@
+#include "queue_spsc.h"
+#include <stdlib.h>
+
+/**
+ * Crea una nueva cola SPSC vacía.
+ * 
+ * @return Un apuntador a la cola creada, alineado a CACHE_LINE. Si la creación falla, devuelve NULL.
+ */
+QueueSPSC* queue_spsc_create(void) {
+    QueueSPSC* q = (QueueSPSC*)aligned_alloc(CACHE_LINE, sizeof(QueueSPSC));
+    if (q == NULL) {
+        return NULL;
+    }
+    atomic_init(&q->head, 0);
+    atomic_init(&q->tail, 0);
+    q->tail_cache = 0;
+    q->head_cache = 0;
+    return q;
+}
+
+/**
+ * Intenta insertar un elemento al final de la cola. Solo debe llamarla el hilo productor.
+ * 
+ * @param q Apuntador a la cola.
+ * @param d Dato que se insertará.
+ * @return `true` si el dato se insertó, `false` si la cola estaba llena. Nunca bloquea.
+ * @details El productor solo vuelve a leer head (línea de caché del consumidor) cuando su copia
+ *          en caché indica que la cola está llena. El dato se publica con un store release
+ *          sobre tail, que hace visible la escritura en datos al consumidor.
+ */
+bool queue_spsc_try_enqueue(QueueSPSC* q, Data d) {
+    unsigned int tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+    if (tail - q->head_cache == TAM) {
+        q->head_cache = atomic_load_explicit(&q->head, memory_order_acquire);
+        if (tail - q->head_cache == TAM) {
+            return false;  // La cola está llena
+        }
+    }
+    q->datos[tail & QUEUE_MASK] = d;
+    atomic_store_explicit(&q->tail, tail + 1, memory_order_release);
+    return true;
+}
+
+/**
+ * Intenta eliminar el elemento al frente de la cola. Solo debe llamarla el hilo consumidor.
+ * 
+ * @param q Apuntador a la cola.
+ * @param out Apuntador donde se guarda el dato extraído.
+ * @return `true` si se extrajo un dato, `false` si la cola estaba vacía. Nunca bloquea.
+ * @details Simétrica a `queue_spsc_try_enqueue`: tail solo se vuelve a leer cuando la copia en
+ *          caché indica que la cola está vacía, y la casilla se libera con un store release sobre head.
+ */
+bool queue_spsc_try_dequeue(QueueSPSC* q, Data* out) {
+    unsigned int head = atomic_load_explicit(&q->head, memory_order_relaxed);
+    if (head == q->tail_cache) {
+        q->tail_cache = atomic_load_explicit(&q->tail, memory_order_acquire);
+        if (head == q->tail_cache) {
+            return false;  // La cola está vacía
+        }
+    }
+    *out = q->datos[head & QUEUE_MASK];
+    atomic_store_explicit(&q->head, head + 1, memory_order_release);
+    return true;
+}
+
+/**
+ * Elimina la cola y libera la memoria asociada a ella.
+ * 
+ * @param q Apuntador a la cola. Ni el productor ni el consumidor deben seguir usándola.
+ */
+void queue_spsc_delete(QueueSPSC* q) {
+    free(q);
+}
@@ -0,0 +1,24 @@
+#ifndef __QUEUE_SPSC_H__
+#define __QUEUE_SPSC_H__
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include "queue.h"
+
+// Cola circular para exactamente un productor y un consumidor, sin candados.
+// head y tail viven en líneas de caché distintas para evitar falso compartido.
+// head y tail son contadores que solo crecen; la casilla se obtiene con QUEUE_MASK.
+typedef struct {
+    _Alignas(CACHE_LINE) atomic_uint head;  // Siguiente posición a leer (la escribe el consumidor)
+    unsigned int tail_cache;                // Copia de tail que guarda el consumidor
+    _Alignas(CACHE_LINE) atomic_uint tail;  // Siguiente posición a escribir (la escribe el productor)
+    unsigned int head_cache;                // Copia de head que guarda el productor
+    _Alignas(CACHE_LINE) Data datos[TAM];   // Arreglo de datos, con la misma capacidad que Queue
+} QueueSPSC;
+
+QueueSPSC* queue_spsc_create(void);
+bool queue_spsc_try_enqueue(QueueSPSC*, Data);
+bool queue_spsc_try_dequeue(QueueSPSC*, Data*);
+void queue_spsc_delete(QueueSPSC*);
+
+#endif // __QUEUE_SPSC_H__
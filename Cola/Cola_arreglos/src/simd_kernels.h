@@ -0,0 +1,234 @@
+#ifndef __SIMD_KERNELS_H__
+#define __SIMD_KERNELS_H__
+#include <limits.h>
+#include <stddef.h>
+
+// Recorridos vectorizados sobre un arreglo contiguo de Data (int de 32 bits). Este archivo no
+// es una interfaz pública: lo incluye el .c de búsquedas y reducciones del módulo, después de
+// definir Data, y elige en tiempo de ejecución la versión AVX2, SSE4.1 o escalar.
+//
+// Las versiones vectoriales se compilan con __attribute__((target(...))), así que el resto del
+// programa no necesita -mavx2 y el binario sigue funcionando en procesadores sin esas
+// instrucciones: solo se llaman si __builtin_cpu_supports las reporta.
+
+typedef char simd_data_32_bits[sizeof(Data) == 4 ? 1 : -1];
+
+// Nivel de instrucciones de un juego de recorridos
+#define SIMD_SCALAR 0
+#define SIMD_SSE4 1
+#define SIMD_AVX2 2
+
+// Un juego de recorridos sobre a[0 .. n-1]; min requiere n > 0
+typedef struct {
+    int (*count)(const Data* a, int n, Data x);     // Cantidad de posiciones con a[i] == x
+    int (*find)(const Data* a, int n, Data x);      // Primera posición con a[i] == x, o -1
+    long long (*sum)(const Data* a, int n);         // Suma sin desbordamiento (en 64 bits)
+    Data (*min)(const Data* a, int n);              // Menor dato
+} SimdKernels;
+
+static int simd_count_scalar(const Data* a, int n, Data x) {
+    int count = 0;
+    for (int i = 0; i < n; i++) {
+        count += a[i] == x;
+    }
+    return count;
+}
+
+static int simd_find_scalar(const Data* a, int n, Data x) {
+    for (int i = 0; i < n; i++) {
+        if (a[i] == x) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static long long simd_sum_scalar(const Data* a, int n) {
+    long long sum = 0;
+    for (int i = 0; i < n; i++) {
+        sum += a[i];
+    }
+    return sum;
+}
+
+static Data simd_min_scalar(const Data* a, int n) {
+    Data min = a[0];
+    for (int i = 1; i < n; i++) {
+        min = a[i] < min ? a[i] : min;
+    }
+    return min;
+}
+
+static const SimdKernels simd_kernels_scalar = {
+    simd_count_scalar, simd_find_scalar, simd_sum_scalar, simd_min_scalar
+};
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define SIMD_X86 1
+
+// ---- SSE4.1: 4 datos por instrucción
+
+__attribute__((target("sse4.1")))
+static int simd_count_sse4(const Data* a, int n, Data x) {
+    __m128i key = _mm_set1_epi32(x);
+    __m128i acc = _mm_setzero_si128();
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(a + i));
+        acc = _mm_sub_epi32(acc, _mm_cmpeq_epi32(v, key));  // Cada coincidencia vale -1
+    }
+    acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+    acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(acc) + simd_count_scalar(a + i, n - i, x);
+}
+
+__attribute__((target("sse4.1")))
+static int simd_find_sse4(const Data* a, int n, Data x) {
+    __m128i key = _mm_set1_epi32(x);
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(a + i));
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(v, key)));
+        if (mask != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+    int j = simd_find_scalar(a + i, n - i, x);
+    return j < 0 ? -1 : i + j;
+}
+
+__attribute__((target("sse4.1")))
+static long long simd_sum_sse4(const Data* a, int n) {
+    __m128i acc = _mm_setzero_si128();  // Dos sumas parciales de 64 bits
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(a + i));
+        acc = _mm_add_epi64(acc, _mm_cvtepi32_epi64(v));
+        acc = _mm_add_epi64(acc, _mm_cvtepi32_epi64(_mm_srli_si128(v, 8)));
+    }
+    long long part[2];
+    _mm_storeu_si128((__m128i*)part, acc);
+    return part[0] + part[1] + simd_sum_scalar(a + i, n - i);
+}
+
+__attribute__((target("sse4.1")))
+static Data simd_min_sse4(const Data* a, int n) {
+    __m128i acc = _mm_set1_epi32(INT_MAX);
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        acc = _mm_min_epi32(acc, _mm_loadu_si128((const __m128i*)(a + i)));
+    }
+    acc = _mm_min_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+    acc = _mm_min_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+    Data min = _mm_cvtsi128_si32(acc);
+    if (i < n) {
+        Data rest = simd_min_scalar(a + i, n - i);
+        min = rest < min ? rest : min;
+    }
+    return min;
+}
+
+static const SimdKernels simd_kernels_sse4 = {
+    simd_count_sse4, simd_find_sse4, simd_sum_sse4, simd_min_sse4
+};
+
+// ---- AVX2: 8 datos por instrucción
+
+__attribute__((target("avx2")))
+static int simd_count_avx2(const Data* a, int n, Data x) {
+    __m256i key = _mm256_set1_epi32(x);
+    __m256i acc = _mm256_setzero_si256();
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(a + i));
+        acc = _mm256_sub_epi32(acc, _mm256_cmpeq_epi32(v, key));
+    }
+    __m128i s = _mm_add_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+    s = _mm_add_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(1, 0, 3, 2)));
+    s = _mm_add_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(s) + simd_count_scalar(a + i, n - i, x);
+}
+
+__attribute__((target("avx2")))
+static int simd_find_avx2(const Data* a, int n, Data x) {
+    __m256i key = _mm256_set1_epi32(x);
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(a + i));
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(v, key)));
+        if (mask != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+    int j = simd_find_scalar(a + i, n - i, x);
+    return j < 0 ? -1 : i + j;
+}
+
+__attribute__((target("avx2")))
+static long long simd_sum_avx2(const Data* a, int n) {
+    __m256i acc = _mm256_setzero_si256();  // Cuatro sumas parciales de 64 bits
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(a + i));
+        acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+        acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+    }
+    long long part[4];
+    _mm256_storeu_si256((__m256i*)part, acc);
+    return part[0] + part[1] + part[2] + part[3] + simd_sum_scalar(a + i, n - i);
+}
+
+__attribute__((target("avx2")))
+static Data simd_min_avx2(const Data* a, int n) {
+    __m256i acc = _mm256_set1_epi32(INT_MAX);
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        acc = _mm256_min_epi32(acc, _mm256_loadu_si256((const __m256i*)(a + i)));
+    }
+    __m128i s = _mm_min_epi32(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+    s = _mm_min_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(1, 0, 3, 2)));
+    s = _mm_min_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(2, 3, 0, 1)));
+    Data min = _mm_cvtsi128_si32(s);
+    if (i < n) {
+        Data rest = simd_min_scalar(a + i, n - i);
+        min = rest < min ? rest : min;
+    }
+    return min;
+}
+
+static const SimdKernels simd_kernels_avx2 = {
+    simd_count_avx2, simd_find_avx2, simd_sum_avx2, simd_min_avx2
+};
+#endif
+
+// Nivel más alto que soporta el procesador en el que corre el programa
+static int simd_cpu_level(void) {
+#ifdef SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return SIMD_AVX2;
+    }
+    if (__builtin_cpu_supports("sse4.1")) {
+        return SIMD_SSE4;
+    }
+#endif
+    return SIMD_SCALAR;
+}
+
+// Juego de recorridos para un nivel, que el llamante ya acotó con simd_cpu_level
+static const SimdKernels* simd_kernels_for(int level) {
+#ifdef SIMD_X86
+    if (level >= SIMD_AVX2) {
+        return &simd_kernels_avx2;
+    }
+    if (level == SIMD_SSE4) {
+        return &simd_kernels_sse4;
+    }
+#else
+    (void)level;
+#endif
+    return &simd_kernels_scalar;
+}
+
+#endif // __SIMD_KERNELS_H__
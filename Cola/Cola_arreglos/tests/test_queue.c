@@ -1,5 +1,15 @@
 #include <check.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
 #include "../src/queue.h"
+#include "../src/queue_spsc.h"
+#include "../src/queue_mpmc.h"
+#include "../src/queue_blocking.h"
+
+#define SPSC_MESSAGES 1000000
+#define MPMC_THREADS 4
+#define MPMC_MESSAGES 100000
 
 START_TEST(test_queue_init) {
     Queue queue = queue_create();
@@ -26,6 +36,280 @@ START_TEST(test_queue_enqueue_dequeue) {
 }
 END_TEST
 
+START_TEST(test_queue_wrap_around) {
+    Queue queue = queue_create();
+
+    // Mantenemos la cola casi vacía mientras los índices dan varias vueltas al anillo
+    for (int i = 0; i < 3 * TAM; i++) {
+        queue_enqueue(&queue, i);
+        queue_enqueue(&queue, i + 1);
+        ck_assert_int_eq(queue_dequeue(&queue), i);
+        ck_assert_int_eq(queue_dequeue(&queue), i + 1);
+    }
+    ck_assert(queue_is_empty(&queue));
+
+    // Tras dar la vuelta sigue cabiendo la capacidad completa
+    for (int i = 0; i < TAM; i++) {
+        queue_enqueue(&queue, i);
+    }
+    ck_assert(queue_is_full(&queue));
+    queue_enqueue(&queue, -5);
+    for (int i = 0; i < TAM; i++) {
+        ck_assert_int_eq(queue_dequeue(&queue), i);
+    }
+    ck_assert(queue_is_empty(&queue));
+}
+END_TEST
+
+START_TEST(test_queue_enqueue_dequeue_n) {
+    Queue queue = queue_create();
+    Data in[TAM + 10];
+    Data out[TAM + 10];
+
+    for (int i = 0; i < TAM + 10; i++) {
+        in[i] = i;
+    }
+    // Movemos head a la mitad para que los bloques den la vuelta al anillo
+    ck_assert_int_eq(queue_enqueue_n(&queue, in, TAM / 2), TAM / 2);
+    ck_assert_int_eq(queue_dequeue_n(&queue, out, TAM / 2), TAM / 2);
+
+    ck_assert_int_eq(queue_enqueue_n(&queue, in, TAM + 10), TAM);
+    ck_assert(queue_is_full(&queue));
+    ck_assert_int_eq(queue_dequeue(&queue), 0);
+    ck_assert_int_eq(queue_dequeue_n(&queue, out, TAM + 10), TAM - 1);
+    for (int i = 0; i < TAM - 1; i++) {
+        ck_assert_int_eq(out[i], i + 1);
+    }
+    ck_assert(queue_is_empty(&queue));
+}
+END_TEST
+
+static void* spsc_producer(void* arg) {
+    QueueSPSC* q = (QueueSPSC*)arg;
+    for (int i = 0; i < SPSC_MESSAGES; i++) {
+        while (!queue_spsc_try_enqueue(q, i)) {
+            sched_yield();  // La cola está llena: cedemos el procesador al consumidor
+        }
+    }
+    return NULL;
+}
+
+#define BLOCKING_MESSAGES 20000
+
+// Productor que inserta mensajes en orden esperando cuando la cola está llena
+static void* blocking_producer(void* arg) {
+    QueueBlocking* q = (QueueBlocking*)arg;
+    for (int i = 0; i < BLOCKING_MESSAGES; i++) {
+        queue_enqueue_wait(q, i, -1);
+    }
+    return NULL;
+}
+
+#ifdef QUEUE_STATS
+START_TEST(test_queue_stats) {
+    Queue q = queue_create();
+    Data in[TAM + 3] = {0};
+    Data out[10];
+
+    queue_enqueue(&q, 1);
+    ck_assert_int_eq(queue_enqueue_n(&q, in, TAM + 3), TAM - 1);
+    queue_enqueue(&q, 2);  // La cola está llena: se descarta
+    queue_dequeue_n(&q, out, 10);
+    queue_dequeue(&q);
+
+    QueueStats st = queue_stats(&q);
+    ck_assert_uint_eq(st.enqueues, TAM);
+    ck_assert_uint_eq(st.dequeues, 11);
+    ck_assert_uint_eq(st.rejected, 5);
+    ck_assert_uint_eq(st.high_water, TAM);
+    ck_assert_uint_eq(st.bytes, TAM * sizeof(Data));
+
+    queue_empty(&q);
+    st = queue_stats(&q);
+    ck_assert_uint_eq(st.enqueues - st.dequeues, 0);
+}
+END_TEST
+#endif
+
+START_TEST(test_queue_blocking) {
+    QueueBlocking* q = queue_blocking_create();
+    Data d;
+
+    // Con plazo 0 no se espera; con plazo positivo se espera y vence
+    ck_assert(!queue_dequeue_wait(q, &d, 0));
+    ck_assert(!queue_dequeue_wait(q, &d, 20));
+    for (int i = 0; i < TAM; i++) {
+        ck_assert(queue_enqueue_wait(q, i, 0));
+    }
+    ck_assert(!queue_enqueue_wait(q, TAM, 20));
+    for (int i = 0; i < TAM; i++) {
+        ck_assert(queue_dequeue_wait(q, &d, 0));
+        ck_assert_int_eq(d, i);
+    }
+
+    // El productor llena la cola y se duerme hasta que el consumidor hace espacio
+    pthread_t producer;
+    pthread_create(&producer, NULL, blocking_producer, q);
+    for (int i = 0; i < BLOCKING_MESSAGES; i++) {
+        ck_assert(queue_dequeue_wait(q, &d, -1));
+        ck_assert_int_eq(d, i);
+    }
+    pthread_join(producer, NULL);
+    ck_assert_int_eq(q->waiting_consumers + q->waiting_producers, 0);
+    queue_blocking_delete(q);
+}
+END_TEST
+
+START_TEST(test_queue_spsc) {
+    QueueSPSC* q = queue_spsc_create();
+    Data d;
+
+    ck_assert(!queue_spsc_try_dequeue(q, &d));
+    for (int i = 0; i < TAM; i++) {
+        ck_assert(queue_spsc_try_enqueue(q, i));
+    }
+    ck_assert(!queue_spsc_try_enqueue(q, TAM));
+    for (int i = 0; i < TAM; i++) {
+        ck_assert(queue_spsc_try_dequeue(q, &d));
+        ck_assert_int_eq(d, i);
+    }
+    ck_assert(!queue_spsc_try_dequeue(q, &d));
+
+    // Un productor y un consumidor en hilos distintos: el orden se conserva
+    pthread_t producer;
+    pthread_create(&producer, NULL, spsc_producer, q);
+    for (int i = 0; i < SPSC_MESSAGES; i++) {
+        while (!queue_spsc_try_dequeue(q, &d)) {
+            sched_yield();  // La cola está vacía: cedemos el procesador al productor
+        }
+        ck_assert_int_eq(d, i);
+    }
+    pthread_join(producer, NULL);
+    queue_spsc_delete(q);
+}
+END_TEST
+
+static void* mpmc_producer(void* arg) {
+    QueueMPMC* q = (QueueMPMC*)arg;
+    for (int i = 1; i <= MPMC_MESSAGES; i++) {
+        while (!queue_mpmc_try_enqueue(q, i)) {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void* mpmc_consumer(void* arg) {
+    QueueMPMC* q = (QueueMPMC*)arg;
+    long long* sum = (long long*)malloc(sizeof(long long));
+    *sum = 0;
+    for (int i = 0; i < MPMC_MESSAGES; i++) {
+        Data d;
+        while (!queue_mpmc_try_dequeue(q, &d)) {
+            sched_yield();
+        }
+        *sum += d;
+    }
+    return sum;
+}
+
+START_TEST(test_queue_mpmc) {
+    QueueMPMC* q = queue_mpmc_create();
+    Data d;
+
+    ck_assert(!queue_mpmc_try_dequeue(q, &d));
+    for (int i = 0; i < TAM; i++) {
+        ck_assert(queue_mpmc_try_enqueue(q, i));
+    }
+    ck_assert(!queue_mpmc_try_enqueue(q, TAM));
+    for (int i = 0; i < TAM; i++) {
+        ck_assert(queue_mpmc_try_dequeue(q, &d));
+        ck_assert_int_eq(d, i);
+    }
+
+    // Varios productores y consumidores: ningún dato se pierde ni se repite
+    pthread_t producers[MPMC_THREADS], consumers[MPMC_THREADS];
+    for (int t = 0; t < MPMC_THREADS; t++) {
+        pthread_create(&producers[t], NULL, mpmc_producer, q);
+        pthread_create(&consumers[t], NULL, mpmc_consumer, q);
+    }
+    long long total = 0;
+    for (int t = 0; t < MPMC_THREADS; t++) {
+        void* sum;
+        pthread_join(producers[t], NULL);
+        pthread_join(consumers[t], &sum);
+        total += *(long long*)sum;
+        free(sum);
+    }
+    ck_assert(total == (long long)MPMC_THREADS * MPMC_MESSAGES * (MPMC_MESSAGES + 1) / 2);
+    ck_assert(!queue_mpmc_try_dequeue(q, &d));
+    queue_mpmc_delete(q);
+}
+END_TEST
+
+START_TEST(test_queue_try_dequeue) {
+    Queue queue = queue_create();
+    Data d = 99;
+
+    ck_assert(!queue_try_dequeue(&queue, &d));
+    ck_assert_int_eq(d, 99);  // Sin datos, out no cambia
+
+    // -1 es un dato como cualquier otro: try_dequeue lo distingue de una cola vacía
+    queue_enqueue(&queue, -1);
+    queue_enqueue(&queue, 5);
+    queue_enqueue(&queue, 6);
+    ck_assert(queue_try_dequeue(&queue, &d));
+    ck_assert_int_eq(d, -1);
+    ck_assert(queue_try_dequeue(&queue, &d));
+    ck_assert_int_eq(d, 5);
+    ck_assert(queue_try_dequeue(&queue, &d));
+    ck_assert_int_eq(d, 6);
+    ck_assert(!queue_try_dequeue(&queue, &d));
+    ck_assert(queue_is_empty(&queue));
+}
+END_TEST
+
+START_TEST(test_queue_simd) {
+    Queue queue = queue_create();
+    Data d;
+
+    ck_assert_int_eq(queue_find(&queue, 0), -1);
+    ck_assert(!queue_min(&queue, &d));
+
+    // Movemos head a la mitad del anillo para que los datos queden en dos tramos
+    for (int i = 0; i < TAM / 2 + 3; i++) {
+        queue_enqueue(&queue, 0);
+        queue_dequeue(&queue);
+    }
+    long long expected_sum = 0;
+    for (int i = 0; i < TAM - 1; i++) {
+        Data v = i % 5 == 0 ? 3 : 2000000000 - i;
+        queue_enqueue(&queue, v);
+        expected_sum += v;
+    }
+    ck_assert_int_gt(queue.head + queue.len, TAM);  // La cola da la vuelta al anillo
+
+    for (int level = QUEUE_SIMD_SCALAR; level <= QUEUE_SIMD_AVX2; level++) {
+        queue_simd_use((QueueSimdLevel)level);
+        ck_assert_int_eq(queue_find(&queue, 3), 0);
+        ck_assert_int_eq(queue_find(&queue, 2000000000 - (TAM - 2)), TAM - 2);  // Segundo tramo
+        ck_assert_int_eq(queue_find(&queue, 4), -1);
+        ck_assert_int_eq(queue_count(&queue, 3), (TAM - 2) / 5 + 1);
+        ck_assert(queue_sum(&queue) == expected_sum);
+        ck_assert(queue_min(&queue, &d));
+        ck_assert_int_eq(d, 3);
+    }
+
+    // El menor en el segundo tramo
+    queue_dequeue(&queue);
+    queue_enqueue(&queue, -1);
+    ck_assert(queue_min(&queue, &d));
+    ck_assert_int_eq(d, -1);
+    ck_assert_int_eq(queue_find(&queue, -1), TAM - 2);
+    queue_simd_use(QUEUE_SIMD_AVX2);
+}
+END_TEST
+
 Suite* queue_suite(void) {
     Suite* s;
     TCase* tc_core;
@@ -35,6 +319,16 @@ Suite* queue_suite(void) {
     tc_core = tcase_create("Core");
     tcase_add_test(tc_core, test_queue_init);
     tcase_add_test(tc_core, test_queue_enqueue_dequeue);
+    tcase_add_test(tc_core, test_queue_wrap_around);
+    tcase_add_test(tc_core, test_queue_enqueue_dequeue_n);
+#ifdef QUEUE_STATS
+    tcase_add_test(tc_core, test_queue_stats);
+#endif
+    tcase_add_test(tc_core, test_queue_blocking);
+    tcase_add_test(tc_core, test_queue_spsc);
+    tcase_add_test(tc_core, test_queue_mpmc);
+    tcase_add_test(tc_core, test_queue_try_dequeue);
+    tcase_add_test(tc_core, test_queue_simd);
     suite_add_tcase(s, tc_core);
 
     return s;
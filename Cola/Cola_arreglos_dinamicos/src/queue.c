@@ -1,113 +1,153 @@
 #include "queue.h"
+#include <limits.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <string.h>
+
+// Versiones normales (no inline) de las operaciones frecuentes
+#ifndef QUEUE_HEADER_ONLY
+#define QUEUE_INLINE
+#include "queue_inline.h"
+#endif
 
 /**
  * Crea una nueva cola vacía y la devuelve.
  * 
- * @param len cantidad de datos que se pueden guardar en el arreglo para la cola
+ * @param len cantidad de datos que se pueden guardar en el arreglo para la cola antes de crecer
  * @return Una nueva cola vacía. Si la creación falla, el estado de la cola es inválido.
- * @details Esta función inicializa una cola vacía. Asigna memoria dinámica con malloc al arreglo data usando len
+ * @details Esta función inicializa una cola vacía. Asigna memoria dinámica con malloc al arreglo data usando len.
+ *          Si len no es positivo se reserva espacio para un solo elemento.
  */
 Queue queue_create(int len) {
     Queue q;
+    if (len < 1) {
+        len = 1;
+    }
     q.data = (Data*)malloc(len * sizeof(Data));  // Asignación dinámica de memoria
+    q.head = 0;
+    q.tail = 0;
+    q.size = 0;
+#ifdef QUEUE_STATS
+    q.stats = (QueueStats){0};
+#endif
     if (q.data == NULL) {
         // Si la asignación falla, devolvemos una cola inválida (con puntero NULL)
-        q.head = -1;
-        q.tail = -1;
         q.len = 0;
         return q;
     }
-    q.head = -1;
-    q.tail = -1;
     q.len = len;
+    QUEUE_STATS_ADD(&q, allocs, 1);
+    QUEUE_STATS_SET(&q, bytes, len * sizeof(Data));
     return q;
 }
 
 /**
- * Inserta un elemento al final de la cola.
+ * Aumenta la capacidad de la cola multiplicándola por QUEUE_GROWTH_FACTOR.
  * 
- * @param q Referencia a la cola donde se insertará el elemento.
- * @param d Dato que se insertará en la cola.
- * @details Esta función añade el dato `d` al final de la cola.
+ * @param q Referencia a la cola que se desea hacer crecer.
+ * @param min_len Capacidad mínima requerida; el factor se aplica las veces necesarias.
+ * @return `true` si la cola creció, `false` si no se pudo reservar la memoria.
+ *         La capacidad nunca pasa de INT_MAX.
+ * @details Se usa realloc y después se "desenvuelve" el anillo: si los elementos daban la vuelta
+ *          al final del arreglo, el tramo que va de head al final se mueve al final del nuevo
+ *          arreglo para que los elementos sigan siendo contiguos en orden circular. Como la
+ *          capacidad crece geométricamente, el costo de insertar es O(1) amortizado.
  */
-void queue_enqueue(Queue* q, Data d) {
-    if (q->tail == q->len - 1) {
-        // Si la cola está llena, no podemos insertar más elementos
-        return;
+bool queue_grow(Queue* q, int min_len) {
+    // Las cuentas se hacen en size_t y se limitan a INT_MAX antes de multiplicar, para que la
+    // capacidad nunca se desborde
+    size_t new_len = (size_t)q->len;
+    while (new_len < (size_t)min_len) {
+        size_t next = new_len > INT_MAX / QUEUE_GROWTH_FACTOR ? (size_t)INT_MAX
+                                                              : new_len * QUEUE_GROWTH_FACTOR;
+        new_len = next > new_len ? next : new_len + 1;
     }
-    if (q->head == -1) {
-        // Si la cola está vacía, inicializamos el índice head
-        q->head = 0;
+    if (new_len > SIZE_MAX / sizeof(Data)) {
+        return false;
     }
-    q->tail++;
-    q->data[q->tail] = d;
-}
-
-/**
- * Elimina y devuelve el elemento al frente de la cola.
- * 
- * @param q Referencia a la cola de la cual se eliminará el elemento.
- * @return El dato que estaba al frente de la cola. Si la cola está vacía o el puntero
- *         `q` es NULL, devuelve un valor que indica error (por ejemplo, un valor predeterminado).
- * @details Esta función elimina el elemento al frente de la cola y lo devuelve.
- *          Si la cola está vacía, no se realiza ninguna operación y se devuelve un valor de error.
- */
-Data queue_dequeue(Queue* q) {
-    if (queue_is_empty(q)) {
-        // Si la cola está vacía, devolvemos un valor de error
-        Data error;
-        return error;  // Asegúrate de definir qué valor de error quieres usar
+    Data *new_data = (Data*)realloc(q->data, new_len * sizeof(Data));
+    if (new_data == NULL) {
+        return false;
     }
-    Data front = q->data[q->head];
-    q->head++;
-    if (q->head > q->tail) {
-        // Si la cola queda vacía, restablecemos los índices
-        q->head = -1;
-        q->tail = -1;
+    if (q->size > 0 && q->head > q->len - q->size) {
+        // Los elementos dan la vuelta: movemos el tramo [head, len) al final del nuevo arreglo
+        int front = q->len - q->head;
+        memmove(new_data + new_len - front, new_data + q->head, front * sizeof(Data));
+        q->head = new_len - front;
     }
-    return front;
+    q->data = new_data;
+    q->len = new_len;
+    QUEUE_STATS_ADD(q, allocs, 1);
+    QUEUE_STATS_ADD(q, grows, 1);
+    QUEUE_STATS_SET(q, bytes, new_len * sizeof(Data));
+    q->tail = (q->head + q->size) % q->len;
+    return true;
 }
 
 /**
- * Verifica si la cola está vacía.
+ * Inserta varios elementos al final de la cola, en orden.
  * 
- * @param q Referencia a la cola que se desea verificar.
- * @return `true` si la cola está vacía, `false` si no lo está. 
- * @details Esta función comprueba si la cola no contiene elementos. Es útil para evitar operaciones
- *          como `queue_dequeue` en una cola vacía.
+ * @param q Referencia a la cola donde se insertarán los elementos.
+ * @param in Arreglo con los datos a insertar.
+ * @param n Cantidad de datos en `in`.
+ * @return Cantidad de datos insertados: n, o 0 si no hubo memoria para hacer crecer la cola o
+ *         si size + n no cabe en un int.
+ * @details La cola crece una sola vez hasta tener espacio para los n datos, y estos se copian
+ *          con a lo más dos `memcpy`: hasta el final del arreglo y desde el inicio del anillo.
  */
-bool queue_is_empty(Queue* q) {
-    return q->head == -1;
+int queue_enqueue_n(Queue* q, const Data* in, int n) {
+    if (q->data == NULL || in == NULL || n <= 0) {
+        return 0;
+    }
+    if (q->len - q->size < n && (n > INT_MAX - q->size || !queue_grow(q, q->size + n))) {
+        QUEUE_STATS_ADD(q, rejected, n);
+        return 0;
+    }
+    int first = n < q->len - q->tail ? n : q->len - q->tail;  // Tramo antes de dar la vuelta
+    memcpy(q->data + q->tail, in, first * sizeof(Data));
+    memcpy(q->data, in + first, (n - first) * sizeof(Data));
+    q->tail = (q->tail + n) % q->len;
+    q->size += n;
+    QUEUE_STATS_ENQUEUED(q, n);
+    return n;
 }
 
 /**
- * Obtiene el elemento al frente de la cola sin eliminarlo.
+ * Extrae varios elementos del frente de la cola, en orden.
  * 
- * @param q Referencia a la cola de la cual se desea obtener el elemento.
- * @return El dato que está al frente de la cola. Si la cola está vacía, devuelve un valor que indica error (por ejemplo, un valor predeterminado).
- * @details Esta función devuelve el elemento al frente de la cola sin modificarla.
- *          Si la cola está vacía, no se realiza ninguna operación y se devuelve un valor de error.
+ * @param q Referencia a la cola de la cual se extraerán los elementos.
+ * @param out Arreglo donde se guardan los datos extraídos.
+ * @param n Cantidad máxima de datos a extraer.
+ * @return Cantidad de datos extraídos, menor que n si la cola se vació.
+ * @details Igual que `queue_enqueue_n`, copia con a lo más dos `memcpy`.
  */
-Data queue_front(Queue* q) {
-    if (queue_is_empty(q)) {
-        // Si la cola está vacía, devolvemos un valor de error
-        Data error;
-        return error;  // Asegúrate de definir qué valor de error quieres usar
+int queue_dequeue_n(Queue* q, Data* out, int n) {
+    if (q->data == NULL || out == NULL || n <= 0) {
+        return 0;
     }
-    return q->data[q->head];
+    int count = n < q->size ? n : q->size;
+    int first = count < q->len - q->head ? count : q->len - q->head;  // Tramo antes de dar la vuelta
+    memcpy(out, q->data + q->head, first * sizeof(Data));
+    memcpy(out + first, q->data, (count - first) * sizeof(Data));
+    q->head = (q->head + count) % q->len;
+    q->size -= count;
+    QUEUE_STATS_DEQUEUED(q, count);
+    return count;
 }
 
 /**
  * Vacía la cola, eliminando todos sus elementos.
  * 
  * @param q Referencia a la cola que se desea vaciar.
- * @details Esta función hace que los índices head y tail tomen el valor de -1
+ * @details Esta función regresa los índices head y tail al inicio del arreglo y pone size en 0.
+ *          La capacidad ya reservada se conserva.
  */
 void queue_empty(Queue* q) {
-    q->head = -1;
-    q->tail = -1;
+    QUEUE_STATS_DEQUEUED(q, q->size);
+    q->head = 0;
+    q->tail = 0;
+    q->size = 0;
 }
 
 /**
@@ -121,9 +161,29 @@ void queue_empty(Queue* q) {
 void queue_delete(Queue* q) {
     if (q->data != NULL) {
         free(q->data);  // Liberamos la memoria dinámica
+        QUEUE_STATS_DEQUEUED(q, q->size);
+        QUEUE_STATS_SET(q, bytes, 0);
         q->data = NULL;
-        q->head = -1;
-        q->tail = -1;
+        q->head = 0;
+        q->tail = 0;
         q->len = 0;
+        q->size = 0;
+    }
+}
+
+#ifdef QUEUE_STATS
+/**
+ * Devuelve una copia de las estadísticas de uso de la cola.
+ * 
+ * @param q Referencia a la cola.
+ * @return Los contadores acumulados desde `queue_create`; todos en 0 si `q` es NULL.
+ * @details Solo existe al compilar con -DQUEUE_STATS. La cantidad actual de elementos es
+ *          enqueues - dequeues, y bytes / sizeof(Data) es la capacidad actual.
+ */
+QueueStats queue_stats(const Queue* q) {
+    if (q == NULL) {
+        return (QueueStats){0};
     }
+    return q->stats;
 }
+#endif
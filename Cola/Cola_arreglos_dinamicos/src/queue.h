@@ -2,21 +2,90 @@
 #define __QUEUE_H__
 
 #include <stdbool.h>
+#include <stddef.h>
 typedef int Data;
 
+// Factor por el que se multiplica la capacidad cuando la cola se llena.
+// Puede cambiarse al compilar, por ejemplo con -DQUEUE_GROWTH_FACTOR=3
+#ifndef QUEUE_GROWTH_FACTOR
+#define QUEUE_GROWTH_FACTOR 2
+#endif
+
+// Estadísticas de uso: al compilar con -DQUEUE_STATS cada cola lleva estos contadores y
+// `queue_stats` devuelve una copia. Sin la bandera la estructura no cambia y los macros
+// QUEUE_STATS_* no generan código.
+#ifdef QUEUE_STATS
+typedef struct {
+    unsigned long enqueues;    // Elementos insertados
+    unsigned long dequeues;    // Elementos que salieron de la cola (dequeue o vaciado)
+    unsigned long rejected;    // Inserciones descartadas porque no hubo memoria para crecer
+    unsigned long grows;       // Veces que creció la capacidad
+    unsigned long allocs;      // Llamadas exitosas a malloc/realloc
+    size_t bytes;              // Bytes reservados actualmente para el arreglo de datos
+    unsigned long high_water;  // Máximo de elementos guardados a la vez
+} QueueStats;
+
+#define QUEUE_STATS_ADD(q, field, n) ((q)->stats.field += (n))
+#define QUEUE_STATS_SET(q, field, v) ((q)->stats.field = (v))
+#define QUEUE_STATS_ENQUEUED(q, n) queue_stats_enqueued(&(q)->stats, (n))
+#define QUEUE_STATS_DEQUEUED(q, n) ((q)->stats.dequeues += (n))
+
+// Cuenta n inserciones y actualiza el máximo de elementos (enqueues - dequeues)
+static inline void queue_stats_enqueued(QueueStats* st, unsigned long n) {
+    st->enqueues += n;
+    if (st->enqueues - st->dequeues > st->high_water) {
+        st->high_water = st->enqueues - st->dequeues;
+    }
+}
+#else
+#define QUEUE_STATS_ADD(q, field, n) ((void)0)
+#define QUEUE_STATS_SET(q, field, v) ((void)0)
+#define QUEUE_STATS_ENQUEUED(q, n) ((void)0)
+#define QUEUE_STATS_DEQUEUED(q, n) ((void)0)
+#endif
+
 typedef struct {
     Data *data;
-    int head;
-    int tail;
-    int len
+    int head;   // Índice del elemento al frente
+    int tail;   // Índice del siguiente espacio libre
+    int len;    // Capacidad del arreglo data
+    int size;   // Cantidad de elementos guardados
+#ifdef QUEUE_STATS
+    QueueStats stats;
+#endif
 } Queue;
 
 Queue queue_create(int len);
+bool queue_grow(Queue*, int);
+int queue_enqueue_n(Queue*, const Data*, int);
+int queue_dequeue_n(Queue*, Data*, int);
+void queue_empty(Queue*);
+void queue_delete(Queue*);
+#ifdef QUEUE_STATS
+QueueStats queue_stats(const Queue*);
+#endif
+
+// Modo sin verificaciones: con -DQUEUE_UNCHECKED las comprobaciones defensivas de apuntadores
+// NULL en las operaciones frecuentes se vuelven assert, que solo existen en compilaciones de
+// depuración; con -DNDEBUG además desaparecen del código. Las verificaciones de cola vacía
+// se conservan, porque forman parte del resultado de las funciones.
+#ifdef QUEUE_UNCHECKED
+#include <assert.h>
+#define QUEUE_INVALID(p) (assert((p) != NULL), false)
+#else
+#define QUEUE_INVALID(p) ((p) == NULL)
+#endif
+
+// Operaciones frecuentes: con -DQUEUE_HEADER_ONLY se definen como static inline en queue_inline.h
+#ifdef QUEUE_HEADER_ONLY
+#define QUEUE_INLINE static inline
+#include "queue_inline.h"
+#else
 void queue_enqueue(Queue* , Data);
 Data queue_dequeue(Queue*);
+bool queue_try_dequeue(Queue*, Data*);
 bool queue_is_empty(Queue*);
 Data queue_front(Queue*);
-void queue_empty(Queue*);
-void queue_delete(Queue*);
+#endif
 
-#endif // __QUEUE_H__
\ No newline at end of file
+#endif // __QUEUE_H__
@@ -0,0 +1,261 @@
+#ifndef __QUEUE_GENERIC_H__
+#define __QUEUE_GENERIC_H__
+#include <limits.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "queue.h"
+
+/*
+ * Cola genérica que guarda elementos de cualquier tipo T directamente, sin índices a una
+ * tabla aparte. DEFINE_QUEUE(name, T, backend) genera el tipo `name` y funciones
+ * `static inline`, con la misma interfaz para los dos backends:
+ *   name name##_create(int len);
+ *   bool name##_enqueue(name*, T);
+ *   bool name##_dequeue(name*, T* out);
+ *   T*   name##_front(name*);
+ *   int  name##_size(name*);
+ *   bool name##_is_empty(name*);
+ *   void name##_empty(name*);
+ *   void name##_delete(name*);
+ *
+ * Backends:
+ *   RING  arreglo circular que crece por QUEUE_GROWTH_FACTOR, como queue.c. `len` es la
+ *         capacidad inicial.
+ *   CHUNK lista desenrollada de bloques de QUEUE_CHUNK_BYTES, como Cola_nodos; nunca copia
+ *         los datos al crecer. `len` se ignora.
+ *
+ * Ejemplo:
+ *   typedef struct { long id; int kind; double value; } Message;
+ *   DEFINE_QUEUE(MessageQueue, Message, RING)
+ *   MessageQueue q = MessageQueue_create(64);
+ */
+
+// Tamaño aproximado en bytes de cada bloque del backend CHUNK (al menos 8 elementos)
+#ifndef QUEUE_CHUNK_BYTES
+#define QUEUE_CHUNK_BYTES 512
+#endif
+
+#define DEFINE_QUEUE(name, T, backend) DEFINE_QUEUE_##backend(name, T)
+
+#ifndef __GENERIC_ALLOC__
+#define __GENERIC_ALLOC__
+// Indica si T necesita una alineación mayor que la que garantiza malloc
+#define GENERIC_OVERALIGNED(T) (_Alignof(T) > _Alignof(max_align_t))
+
+// Cambia el tamaño de un arreglo de T conservando su alineación; devuelve NULL si falla
+#define GENERIC_RESIZE(T, ptr, new_len, copy_len)                                           \
+    (GENERIC_OVERALIGNED(T) ? generic_realloc_aligned((ptr), _Alignof(T),                   \
+                                                      (new_len) * sizeof(T),                \
+                                                      (copy_len) * sizeof(T))               \
+                            : realloc((ptr), (new_len) * sizeof(T)))
+
+/**
+ * realloc para bloques con alineación mayor a la de malloc: reserva con aligned_alloc,
+ * copia los primeros `copy` bytes y libera el bloque anterior.
+ */
+static inline void* generic_realloc_aligned(void* ptr, size_t align, size_t size, size_t copy) {
+    void* block = aligned_alloc(align, size);
+    if (block == NULL) {
+        return NULL;
+    }
+    if (ptr != NULL) {
+        memcpy(block, ptr, copy < size ? copy : size);
+        free(ptr);
+    }
+    return block;
+}
+#endif // __GENERIC_ALLOC__
+
+#define DEFINE_QUEUE_RING(name, T)                                                          \
+    typedef struct {                                                                        \
+        T* data;                                                                            \
+        int head;                                                                           \
+        int tail;                                                                           \
+        int len;                                                                            \
+        int size;                                                                           \
+    } name;                                                                                 \
+                                                                                            \
+    static inline name name##_create(int len) {                                             \
+        name q;                                                                             \
+        if (len < 1) {                                                                      \
+            len = 1;                                                                        \
+        }                                                                                   \
+        q.data = (T*)GENERIC_RESIZE(T, NULL, len, 0);                                       \
+        q.head = 0;                                                                         \
+        q.tail = 0;                                                                         \
+        q.size = 0;                                                                         \
+        q.len = q.data == NULL ? 0 : len;                                                   \
+        return q;                                                                           \
+    }                                                                                       \
+                                                                                            \
+    static inline bool name##_grow(name* q) {                                               \
+        /* En size_t y con tope INT_MAX antes de multiplicar: así no se desborda */           \
+        size_t new_len = q->len > INT_MAX / QUEUE_GROWTH_FACTOR                             \
+                             ? (size_t)INT_MAX : (size_t)q->len * QUEUE_GROWTH_FACTOR;      \
+        if (new_len <= (size_t)q->len) {                                                    \
+            if (q->len == INT_MAX) {                                                        \
+                return false;                                                               \
+            }                                                                               \
+            new_len = (size_t)q->len + 1;                                                   \
+        }                                                                                   \
+        if (new_len > SIZE_MAX / sizeof(T)) {                                               \
+            return false;                                                                   \
+        }                                                                                   \
+        T* data = (T*)GENERIC_RESIZE(T, q->data, new_len, q->len);                          \
+        if (data == NULL) {                                                                 \
+            return false;                                                                   \
+        }                                                                                   \
+        if (q->size > 0 && q->head > q->len - q->size) {                                    \
+            int front = q->len - q->head;                                                   \
+            memmove(data + new_len - front, data + q->head, front * sizeof(T));             \
+            q->head = (int)new_len - front;                                                 \
+        }                                                                                   \
+        q->data = data;                                                                     \
+        q->len = (int)new_len;                                                              \
+        q->tail = (q->head + q->size) % q->len;                                             \
+        return true;                                                                        \
+    }                                                                                       \
+                                                                                            \
+    static inline bool name##_enqueue(name* q, T d) {                                       \
+        if (q->size == q->len && (q->data == NULL || !name##_grow(q))) {                    \
+            return false;                                                                   \
+        }                                                                                   \
+        q->data[q->tail] = d;                                                               \
+        if (++q->tail == q->len) {                                                          \
+            q->tail = 0;                                                                    \
+        }                                                                                   \
+        q->size++;                                                                          \
+        return true;                                                                        \
+    }                                                                                       \
+                                                                                            \
+    static inline bool name##_dequeue(name* q, T* out) {                                    \
+        if (q->size == 0) {                                                                 \
+            return false;                                                                   \
+        }                                                                                   \
+        *out = q->data[q->head];                                                            \
+        if (++q->head == q->len) {                                                          \
+            q->head = 0;                                                                    \
+        }                                                                                   \
+        q->size--;                                                                          \
+        return true;                                                                        \
+    }                                                                                       \
+                                                                                            \
+    static inline T* name##_front(name* q) {                                                \
+        return q->size == 0 ? NULL : &q->data[q->head];                                     \
+    }                                                                                       \
+                                                                                            \
+    static inline int name##_size(name* q) {                                                \
+        return q->size;                                                                     \
+    }                                                                                       \
+                                                                                            \
+    static inline bool name##_is_empty(name* q) {                                           \
+        return q->size == 0;                                                                \
+    }                                                                                       \
+                                                                                            \
+    static inline void name##_empty(name* q) {                                              \
+        q->head = 0;                                                                        \
+        q->tail = 0;                                                                        \
+        q->size = 0;                                                                        \
+    }                                                                                       \
+                                                                                            \
+    static inline void name##_delete(name* q) {                                             \
+        free(q->data);                                                                      \
+        q->data = NULL;                                                                     \
+        q->len = 0;                                                                         \
+        name##_empty(q);                                                                    \
+    }
+
+#define DEFINE_QUEUE_CHUNK(name, T)                                                         \
+    enum {                                                                                  \
+        name##_CHUNK_CAP = sizeof(T) * 8 >= QUEUE_CHUNK_BYTES ? 8 : QUEUE_CHUNK_BYTES / sizeof(T) \
+    };                                                                                      \
+                                                                                            \
+    typedef struct name##_Chunk {                                                           \
+        T data[name##_CHUNK_CAP];                                                           \
+        int head;                                                                           \
+        int tail;                                                                           \
+        struct name##_Chunk* next;                                                          \
+    } name##_Chunk;                                                                         \
+                                                                                            \
+    typedef struct {                                                                        \
+        name##_Chunk* head;                                                                 \
+        name##_Chunk* tail;                                                                 \
+        int size;                                                                           \
+    } name;                                                                                 \
+                                                                                            \
+    static inline name name##_create(int len) {                                             \
+        (void)len;                                                                          \
+        name q = { NULL, NULL, 0 };                                                         \
+        return q;                                                                           \
+    }                                                                                       \
+                                                                                            \
+    static inline bool name##_enqueue(name* q, T d) {                                       \
+        if (q->tail == NULL || q->tail->tail == name##_CHUNK_CAP) {                         \
+            name##_Chunk* c = (name##_Chunk*)GENERIC_RESIZE(name##_Chunk, NULL, 1, 0);      \
+            if (c == NULL) {                                                                \
+                return false;                                                               \
+            }                                                                               \
+            c->head = 0;                                                                    \
+            c->tail = 0;                                                                    \
+            c->next = NULL;                                                                 \
+            if (q->tail == NULL) {                                                          \
+                q->head = c;                                                                \
+            } else {                                                                        \
+                q->tail->next = c;                                                          \
+            }                                                                               \
+            q->tail = c;                                                                    \
+        }                                                                                   \
+        q->tail->data[q->tail->tail++] = d;                                                 \
+        q->size++;                                                                          \
+        return true;                                                                        \
+    }                                                                                       \
+                                                                                            \
+    static inline bool name##_dequeue(name* q, T* out) {                                    \
+        if (q->size == 0) {                                                                 \
+            return false;                                                                   \
+        }                                                                                   \
+        name##_Chunk* c = q->head;                                                          \
+        *out = c->data[c->head++];                                                          \
+        q->size--;                                                                          \
+        if (c->head == c->tail) {                                                           \
+            if (c == q->tail) {                                                             \
+                c->head = 0;                                                                \
+                c->tail = 0;                                                                \
+            } else {                                                                        \
+                q->head = c->next;                                                          \
+                free(c);                                                                    \
+            }                                                                               \
+        }                                                                                   \
+        return true;                                                                        \
+    }                                                                                       \
+                                                                                            \
+    static inline T* name##_front(name* q) {                                                \
+        return q->size == 0 ? NULL : &q->head->data[q->head->head];                         \
+    }                                                                                       \
+                                                                                            \
+    static inline int name##_size(name* q) {                                                \
+        return q->size;                                                                     \
+    }                                                                                       \
+                                                                                            \
+    static inline bool name##_is_empty(name* q) {                                           \
+        return q->size == 0;                                                                \
+    }                                                                                       \
+                                                                                            \
+    static inline void name##_delete(name* q) {                                             \
+        while (q->head != NULL) {                                                           \
+            name##_Chunk* next = q->head->next;                                             \
+            free(q->head);                                                                  \
+            q->head = next;                                                                 \
+        }                                                                                   \
+        q->tail = NULL;                                                                     \
+        q->size = 0;                                                                        \
+    }                                                                                       \
+                                                                                            \
+    static inline void name##_empty(name* q) {                                              \
+        name##_delete(q);                                                                   \
+    }
+
+#endif // __QUEUE_GENERIC_H__
@@ -0,0 +1,115 @@
+#ifndef __QUEUE_INLINE_H__
+#define __QUEUE_INLINE_H__
+#include <limits.h>
+#include <stddef.h>
+
+// Operaciones frecuentes de la cola. Este archivo no se incluye directamente:
+// queue.h lo incluye con QUEUE_INLINE = static inline cuando se compila con -DQUEUE_HEADER_ONLY,
+// para que el compilador pueda integrarlas en el código que las llama, y queue.c lo incluye
+// con QUEUE_INLINE vacío para generar las versiones normales.
+
+/**
+ * Verifica si la cola está vacía.
+ * 
+ * @param q Referencia a la cola que se desea verificar.
+ * @return `true` si la cola está vacía, `false` si no lo está. 
+ * @details Esta función comprueba si la cola no contiene elementos. Es útil para evitar operaciones
+ *          como `queue_dequeue` en una cola vacía.
+ */
+QUEUE_INLINE bool queue_is_empty(Queue* q) {
+    return q->size == 0;
+}
+
+/**
+ * Inserta un elemento al final de la cola.
+ * 
+ * @param q Referencia a la cola donde se insertará el elemento.
+ * @param d Dato que se insertará en la cola.
+ * @details Esta función añade el dato `d` al final de la cola. Si el arreglo está lleno se hace
+ *          crecer con `queue_grow`; solo si no hay memoria el dato no se inserta.
+ */
+QUEUE_INLINE void queue_enqueue(Queue* q, Data d) {
+    if (QUEUE_INVALID(q->data)) {
+        return;
+    }
+    if (q->size == q->len && (q->len == INT_MAX || !queue_grow(q, q->len + 1))) {
+        // No se pudo hacer crecer la cola, no podemos insertar el elemento
+        QUEUE_STATS_ADD(q, rejected, 1);
+        return;
+    }
+    q->data[q->tail] = d;
+    q->tail++;
+    if (q->tail == q->len) {
+        q->tail = 0;  // Damos la vuelta al anillo
+    }
+    q->size++;
+    QUEUE_STATS_ENQUEUED(q, 1);
+}
+
+/**
+ * Elimina y devuelve el elemento al frente de la cola.
+ * 
+ * @param q Referencia a la cola de la cual se eliminará el elemento.
+ * @return El dato que estaba al frente de la cola. Si la cola está vacía o el puntero
+ *         `q` es NULL, devuelve un valor que indica error (por ejemplo, un valor predeterminado).
+ * @details Esta función elimina el elemento al frente de la cola y lo devuelve.
+ *          Si la cola está vacía, no se realiza ninguna operación y se devuelve un valor de error.
+ */
+QUEUE_INLINE Data queue_dequeue(Queue* q) {
+    if (queue_is_empty(q)) {
+        // Si la cola está vacía, devolvemos un valor de error
+        Data error = -1;
+        return error;
+    }
+    Data front = q->data[q->head];
+    q->head++;
+    if (q->head == q->len) {
+        q->head = 0;  // Damos la vuelta al anillo
+    }
+    q->size--;
+    QUEUE_STATS_DEQUEUED(q, 1);
+    return front;
+}
+
+/**
+ * Obtiene el elemento al frente de la cola sin eliminarlo.
+ * 
+ * @param q Referencia a la cola de la cual se desea obtener el elemento.
+ * @return El dato que está al frente de la cola. Si la cola está vacía, devuelve un valor que indica error (por ejemplo, un valor predeterminado).
+ * @details Esta función devuelve el elemento al frente de la cola sin modificarla.
+ *          Si la cola está vacía, no se realiza ninguna operación y se devuelve un valor de error.
+ */
+QUEUE_INLINE Data queue_front(Queue* q) {
+    if (queue_is_empty(q)) {
+        // Si la cola está vacía, devolvemos un valor de error
+        Data error = -1;
+        return error;
+    }
+    return q->data[q->head];
+}
+
+/**
+ * Intenta extraer el elemento al frente de la cola.
+ * 
+ * @param q Referencia a la cola de la cual se extraerá el elemento.
+ * @param out Donde se guarda el dato extraído.
+ * @return `true` si se extrajo un dato, `false` si la cola está vacía (out no cambia).
+ * @details A diferencia de `queue_dequeue`, no hay un valor de error que se confunda con un
+ *          dato, así que no hace falta llamar antes a `queue_is_empty`: la cola se revisa una
+ *          sola vez.
+ */
+QUEUE_INLINE bool queue_try_dequeue(Queue* q, Data* out) {
+    if (QUEUE_INVALID(out) || q->size == 0) {
+        return false;
+    }
+    *out = q->data[q->head];
+    q->head++;
+    if (q->head == q->len) {
+        q->head = 0;  // Damos la vuelta al anillo
+    }
+    q->size--;
+    QUEUE_STATS_DEQUEUED(q, 1);
+    return true;
+}
+
+#endif // __QUEUE_INLINE_H__
@@ -0,0 +1,350 @@
+#define _POSIX_C_SOURCE 200809L  // ftruncate, msync, clock_gettime
+#include "queue_mmap.h"
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// queue_mmap_grow copia el tramo que da la vuelta más allá de la capacidad vieja; con un factor
+// menor que 2 el destino se encimaría con el origen y pisaría datos antes de confirmar el cambio.
+_Static_assert(QUEUE_GROWTH_FACTOR >= 2, "queue_mmap necesita QUEUE_GROWTH_FACTOR >= 2");
+
+/**
+ * Bytes que ocupa un archivo con capacidad para len datos.
+ */
+static size_t queue_mmap_file_size(uint64_t len) {
+    return sizeof(QueueMmapHeader) + len * sizeof(Data);
+}
+
+/**
+ * Verifica que una capacidad y sus contadores sean coherentes con el tamaño del archivo.
+ *
+ * @param size Tamaño del archivo en bytes, al menos sizeof(QueueMmapHeader).
+ * @details len viene del archivo: se compara con la capacidad que cabe en `size` en lugar de
+ *          calcular el tamaño que necesitaría, que con un len corrupto puede desbordarse.
+ */
+static bool queue_mmap_counters_valid(uint64_t len, uint64_t head, uint64_t tail, size_t size) {
+    return len >= 1
+        && len <= (size - sizeof(QueueMmapHeader)) / sizeof(Data)
+        && head <= tail
+        && tail - head <= len;
+}
+
+/**
+ * Verifica que un archivo existente sea una cola válida para este programa.
+ *
+ * @param hdr Encabezado leído del archivo.
+ * @param size Tamaño del archivo en bytes, al menos sizeof(QueueMmapHeader).
+ * @return `true` si el encabezado es coherente con el tamaño del archivo.
+ * @details Si hay un crecimiento confirmado sin aplicar (grow == 1) se verifican los valores
+ *          de grow_*, que son los que quedarán en uso; len, head y tail pueden estar a medias.
+ */
+static bool queue_mmap_header_valid(const QueueMmapHeader* hdr, size_t size) {
+    if (hdr->magic != QUEUE_MMAP_MAGIC
+        || hdr->version != QUEUE_MMAP_VERSION
+        || hdr->elem_size != sizeof(Data)) {
+        return false;
+    }
+    if (hdr->grow == 1) {
+        return queue_mmap_counters_valid(hdr->grow_len, hdr->grow_head, hdr->grow_tail, size);
+    }
+    return hdr->grow == 0 && queue_mmap_counters_valid(hdr->len, hdr->head, hdr->tail, size);
+}
+
+/**
+ * Aplica el crecimiento confirmado en grow_*: copia len, head y tail y borra la marca.
+ *
+ * @details Solo lee grow_*, así que repetirla después de una caída a la mitad da el mismo
+ *          resultado. La marca se borra después de sincronizar los valores nuevos.
+ */
+static void queue_mmap_finish_grow(QueueMmapHeader* hdr) {
+    hdr->len = hdr->grow_len;
+    hdr->head = hdr->grow_head;
+    hdr->tail = hdr->grow_tail;
+    msync(hdr, sizeof(QueueMmapHeader), MS_SYNC);
+    hdr->grow = 0;
+    msync(hdr, sizeof(QueueMmapHeader), MS_SYNC);
+}
+
+/**
+ * Lleva al disco las páginas que contienen [offset, offset + bytes) del mapa.
+ */
+static void queue_mmap_sync_range(QueueMmap* q, size_t offset, size_t bytes) {
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t start = offset / page * page;
+    msync((char*)q->hdr + start, offset + bytes - start, MS_SYNC);
+}
+
+/**
+ * Aplica la política de sincronización después de una operación.
+ *
+ * @param q Apuntador a la cola.
+ * @param slot Casilla del arreglo que escribió la operación, o -1 si solo cambió el encabezado.
+ * @details Con QUEUE_MMAP_SYNC_OP solo se sincronizan las páginas que tocó la operación (la del
+ *          encabezado y la de la casilla), no el mapa completo.
+ */
+static void queue_mmap_after_op(QueueMmap* q, long slot) {
+    q->pending++;
+    switch (q->sync.mode) {
+    case QUEUE_MMAP_SYNC_OP:
+        if (slot >= 0) {
+            queue_mmap_sync_range(q, sizeof(QueueMmapHeader) + slot * sizeof(Data), sizeof(Data));
+        }
+        queue_mmap_sync_range(q, 0, sizeof(QueueMmapHeader));
+        q->pending = 0;
+        break;
+    case QUEUE_MMAP_SYNC_BATCH:
+        if (q->pending >= q->sync.batch) {
+            queue_mmap_flush(q);
+        }
+        break;
+    case QUEUE_MMAP_SYNC_PERIODIC: {
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        long elapsed_ms = (now.tv_sec - q->last_sync.tv_sec) * 1000
+                        + (now.tv_nsec - q->last_sync.tv_nsec) / 1000000;
+        if (elapsed_ms >= q->sync.period_ms) {
+            queue_mmap_flush(q);
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+/**
+ * Abre una cola persistente, creando el archivo si no existe.
+ *
+ * @param path Ruta del archivo que guarda la cola.
+ * @param len Capacidad inicial si el archivo es nuevo; si ya existe se usa la guardada en él.
+ * @param sync Política de msync.
+ * @return Un apuntador a la cola, con los datos que tenía el archivo. Si el archivo no se pudo
+ *         abrir o mapear, o existe pero no es una cola válida (otro formato, otro tamaño de Data,
+ *         encabezado incoherente), devuelve NULL y el archivo no se modifica.
+ * @details Un archivo vacío se trata como nuevo: se le da el tamaño necesario con ftruncate y
+ *          se escribe el encabezado. Si el archivo quedó con un crecimiento confirmado pero sin
+ *          aplicar, se termina de aplicar antes de devolver la cola.
+ */
+QueueMmap* queue_mmap_create(const char* path, int len, QueueMmapSync sync) {
+    if (path == NULL) {
+        return NULL;
+    }
+    if (len < 1) {
+        len = 1;
+    }
+    if (sync.mode == QUEUE_MMAP_SYNC_BATCH && sync.batch < 1) {
+        sync.batch = 1;
+    }
+
+    int fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        return NULL;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return NULL;
+    }
+
+    bool fresh = st.st_size == 0;
+    size_t size = fresh ? queue_mmap_file_size(len) : (size_t)st.st_size;
+    if ((fresh && ftruncate(fd, size) != 0) || size < sizeof(QueueMmapHeader)) {
+        close(fd);
+        return NULL;
+    }
+    void *map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (map == MAP_FAILED) {
+        close(fd);
+        return NULL;
+    }
+
+    QueueMmapHeader *hdr = (QueueMmapHeader*)map;
+    if (fresh) {
+        memset(hdr, 0, sizeof(QueueMmapHeader));
+        hdr->magic = QUEUE_MMAP_MAGIC;
+        hdr->version = QUEUE_MMAP_VERSION;
+        hdr->elem_size = sizeof(Data);
+        hdr->len = len;
+        msync(map, size, MS_SYNC);
+    } else if (!queue_mmap_header_valid(hdr, size)) {
+        munmap(map, size);
+        close(fd);
+        return NULL;
+    } else if (hdr->grow == 1) {
+        queue_mmap_finish_grow(hdr);  // El proceso anterior se cayó a mitad de un crecimiento
+    }
+
+    QueueMmap *q = (QueueMmap*)malloc(sizeof(QueueMmap));
+    if (q == NULL) {
+        munmap(map, size);
+        close(fd);
+        return NULL;
+    }
+    q->hdr = hdr;
+    q->data = (Data*)(hdr + 1);
+    q->map_size = size;
+    q->fd = fd;
+    q->sync = sync;
+    q->pending = 0;
+    clock_gettime(CLOCK_MONOTONIC, &q->last_sync);
+    return q;
+}
+
+/**
+ * Multiplica la capacidad de la cola por QUEUE_GROWTH_FACTOR, agrandando el archivo.
+ *
+ * @param q Apuntador a la cola.
+ * @return `true` si la cola creció, `false` si la nueva capacidad no cabe en size_t o no se pudo
+ *         agrandar o volver a mapear el archivo.
+ * @details Igual que `queue_grow`, desenvuelve el anillo: el tramo [head, len) se copia al final
+ *          del nuevo arreglo. La copia no pisa datos viejos y se sincroniza antes de tocar el
+ *          encabezado. Los valores nuevos de len, head y tail se guardan en grow_* y se confirman
+ *          con una sola escritura de grow: una caída antes de esa escritura deja la cola como
+ *          estaba, y una posterior la completa `queue_mmap_create`. Todo se sincroniza de
+ *          inmediato sin importar la política.
+ */
+static bool queue_mmap_grow(QueueMmap* q) {
+    uint64_t len = q->hdr->len;
+    // La capacidad nueva debe caber en el archivo sin desbordar queue_mmap_file_size
+    if (len > (SIZE_MAX - sizeof(QueueMmapHeader)) / sizeof(Data) / QUEUE_GROWTH_FACTOR) {
+        return false;
+    }
+    uint64_t new_len = len * QUEUE_GROWTH_FACTOR;
+    size_t new_size = queue_mmap_file_size(new_len);
+    if (new_size > q->map_size && ftruncate(q->fd, new_size) != 0) {
+        return false;
+    }
+    if (new_size < q->map_size) {
+        new_size = q->map_size;  // El archivo ya era más grande (un crecimiento que no terminó)
+    }
+    void *map = mmap(NULL, new_size, PROT_READ | PROT_WRITE, MAP_SHARED, q->fd, 0);
+    if (map == MAP_FAILED) {
+        return false;
+    }
+    munmap(q->hdr, q->map_size);
+    q->hdr = (QueueMmapHeader*)map;
+    q->data = (Data*)(q->hdr + 1);
+    q->map_size = new_size;
+
+    uint64_t size = q->hdr->tail - q->hdr->head;
+    uint64_t head = q->hdr->head % len;
+    if (size > 0 && head + size > len) {
+        // Los elementos dan la vuelta: copiamos el tramo [head, len) al final del nuevo arreglo
+        uint64_t front = len - head;
+        memcpy(q->data + new_len - front, q->data + head, front * sizeof(Data));
+        msync(map, new_size, MS_SYNC);
+        head = new_len - front;
+    }
+    q->hdr->grow_len = new_len;
+    q->hdr->grow_head = head;
+    q->hdr->grow_tail = head + size;
+    msync(map, sizeof(QueueMmapHeader), MS_SYNC);
+    q->hdr->grow = 1;  // Punto de confirmación
+    msync(map, sizeof(QueueMmapHeader), MS_SYNC);
+    queue_mmap_finish_grow(q->hdr);
+    return true;
+}
+
+/**
+ * Inserta un elemento al final de la cola.
+ *
+ * @param q Apuntador a la cola.
+ * @param d Dato que se insertará.
+ * @return `true` si el dato se insertó, `false` si `q` es NULL o no se pudo hacer crecer el archivo.
+ * @details El dato se escribe en su casilla antes de avanzar tail, así que tras una caída del
+ *          proceso tail nunca cuenta un dato que no se escribió.
+ */
+bool queue_mmap_enqueue(QueueMmap* q, Data d) {
+    if (q == NULL) {
+        return false;
+    }
+    if (q->hdr->tail - q->hdr->head == q->hdr->len && !queue_mmap_grow(q)) {
+        return false;
+    }
+    long slot = q->hdr->tail % q->hdr->len;
+    q->data[slot] = d;
+    q->hdr->tail++;
+    queue_mmap_after_op(q, slot);
+    return true;
+}
+
+/**
+ * Elimina y devuelve el elemento al frente de la cola.
+ *
+ * @param q Apuntador a la cola.
+ * @return El dato que estaba al frente, o -1 si la cola está vacía o `q` es NULL.
+ */
+Data queue_mmap_dequeue(QueueMmap* q) {
+    if (queue_mmap_is_empty(q)) {
+        return -1;
+    }
+    Data d = q->data[q->hdr->head % q->hdr->len];
+    q->hdr->head++;
+    queue_mmap_after_op(q, -1);
+    return d;
+}
+
+/**
+ * Obtiene el elemento al frente de la cola sin eliminarlo.
+ *
+ * @param q Apuntador a la cola.
+ * @return El dato al frente, o -1 si la cola está vacía o `q` es NULL.
+ */
+Data queue_mmap_front(QueueMmap* q) {
+    if (queue_mmap_is_empty(q)) {
+        return -1;
+    }
+    return q->data[q->hdr->head % q->hdr->len];
+}
+
+/**
+ * Verifica si la cola está vacía.
+ *
+ * @param q Apuntador a la cola.
+ * @return `true` si la cola está vacía o `q` es NULL.
+ */
+bool queue_mmap_is_empty(QueueMmap* q) {
+    return q == NULL || q->hdr->head == q->hdr->tail;
+}
+
+/**
+ * Devuelve la cantidad de elementos guardados en la cola.
+ */
+int queue_mmap_size(QueueMmap* q) {
+    return q == NULL ? 0 : (int)(q->hdr->tail - q->hdr->head);
+}
+
+/**
+ * Lleva al disco todos los cambios pendientes, sin importar la política.
+ *
+ * @param q Apuntador a la cola.
+ * @return `true` si msync tuvo éxito.
+ */
+bool queue_mmap_flush(QueueMmap* q) {
+    if (q == NULL) {
+        return false;
+    }
+    q->pending = 0;
+    clock_gettime(CLOCK_MONOTONIC, &q->last_sync);
+    return msync(q->hdr, q->map_size, MS_SYNC) == 0;
+}
+
+/**
+ * Cierra la cola: sincroniza, desmapea el archivo y libera la estructura.
+ *
+ * @param q Apuntador a la cola.
+ * @details El archivo se conserva con su contenido; para descartar la cola hay que borrarlo.
+ */
+void queue_mmap_close(QueueMmap* q) {
+    if (q == NULL) {
+        return;
+    }
+    queue_mmap_flush(q);
+    munmap(q->hdr, q->map_size);
+    close(q->fd);
+    free(q);
+}
@@ -0,0 +1,78 @@
+#ifndef __QUEUE_MMAP_H__
+#define __QUEUE_MMAP_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+#include "queue.h"
+
+/*
+ * Cola persistente: el arreglo circular y sus índices viven en un archivo mapeado en memoria
+ * (mmap con MAP_SHARED). Insertar y extraer son escrituras directas en el mapa, sin copias ni
+ * llamadas al sistema; el contenido sobrevive a que el proceso termine o se caiga, y al volver
+ * a abrir el archivo con `queue_mmap_create` la cola sigue donde estaba.
+ *
+ * Formato del archivo: un encabezado QueueMmapHeader de 64 bytes seguido de `len` datos.
+ * head y tail son contadores que solo crecen (la casilla es contador % len), así que cada
+ * inserción o extracción actualiza un solo campo de 8 bytes del encabezado.
+ *
+ * Crecer cambia len, head y tail juntos. Los valores nuevos se escriben primero en grow_len,
+ * grow_head y grow_tail y después se confirman con una sola escritura de grow = 1; si el proceso
+ * se cae antes, la cola sigue como estaba, y si se cae después, `queue_mmap_create` termina de
+ * copiar los valores confirmados al abrir el archivo.
+ *
+ * Para sobrevivir también a una caída del sistema operativo los cambios deben llegar al disco
+ * con msync; la política QueueMmapSync decide cuándo, intercambiando durabilidad por velocidad.
+ */
+
+#define QUEUE_MMAP_MAGIC 0x51554555u  // "QUEU"
+#define QUEUE_MMAP_VERSION 1
+
+typedef struct {
+    uint32_t magic;      // QUEUE_MMAP_MAGIC, identifica el archivo
+    uint32_t version;    // QUEUE_MMAP_VERSION
+    uint32_t elem_size;  // sizeof(Data) del programa que creó el archivo
+    uint32_t grow;       // 1 si hay un crecimiento confirmado en grow_* que falta aplicar
+    uint64_t len;        // Capacidad del arreglo de datos
+    uint64_t head;       // Cantidad de datos extraídos desde que se creó el archivo
+    uint64_t tail;       // Cantidad de datos insertados desde que se creó el archivo
+    uint64_t grow_len;   // len, head y tail después del crecimiento en curso
+    uint64_t grow_head;
+    uint64_t grow_tail;
+} QueueMmapHeader;
+
+// Cuándo se llama a msync para llevar los cambios al disco
+typedef enum {
+    QUEUE_MMAP_SYNC_NONE,      // Solo con queue_mmap_flush o al cerrar
+    QUEUE_MMAP_SYNC_OP,        // Después de cada operación: lo más durable y lo más lento
+    QUEUE_MMAP_SYNC_BATCH,     // Cada `batch` operaciones
+    QUEUE_MMAP_SYNC_PERIODIC,  // Cuando pasaron al menos `period_ms` milisegundos desde el último
+} QueueMmapSyncMode;
+
+typedef struct {
+    QueueMmapSyncMode mode;
+    int batch;      // Operaciones entre msync con QUEUE_MMAP_SYNC_BATCH
+    int period_ms;  // Milisegundos entre msync con QUEUE_MMAP_SYNC_PERIODIC
+} QueueMmapSync;
+
+typedef struct {
+    QueueMmapHeader *hdr;  // Inicio del mapa: encabezado en el archivo
+    Data *data;            // Arreglo circular, justo después del encabezado
+    size_t map_size;       // Bytes mapeados (tamaño del archivo)
+    int fd;
+    QueueMmapSync sync;
+    int pending;                 // Operaciones desde el último msync
+    struct timespec last_sync;   // Momento del último msync
+} QueueMmap;
+
+QueueMmap* queue_mmap_create(const char* path, int len, QueueMmapSync sync);
+bool queue_mmap_enqueue(QueueMmap*, Data);
+Data queue_mmap_dequeue(QueueMmap*);
+Data queue_mmap_front(QueueMmap*);
+bool queue_mmap_is_empty(QueueMmap*);
+int queue_mmap_size(QueueMmap*);
+bool queue_mmap_flush(QueueMmap*);
+void queue_mmap_close(QueueMmap*);
+
+#endif // __QUEUE_MMAP_H__
@@ -0,0 +1,193 @@
+#define _POSIX_C_SOURCE 200112L  // fileno, posix_fadvise
+#include "queue_spill.h"
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * Crea una cola vacía que guarda en memoria a lo más budget_bytes de datos.
+ *
+ * @param budget_bytes Memoria máxima para los datos en memoria; se usan al menos 4 elementos.
+ * @return Una nueva cola vacía. Si la creación falla, head.data es NULL.
+ */
+QueueSpill queue_spill_create(size_t budget_bytes) {
+    QueueSpill q;
+    size_t budget = budget_bytes / sizeof(Data);
+
+    q.budget = budget < 4 ? 4 : (budget > 1 << 30 ? 1 << 30 : (int)budget);
+    q.segment = q.budget / 4;
+    q.head = queue_create(q.budget - q.segment);
+    q.tail = (Data*)malloc(q.segment * sizeof(Data));
+    q.tail_len = 0;
+    q.segments = NULL;
+    q.seg_first = 0;
+    q.n_segments = 0;
+    q.cap_segments = 0;
+    if (q.tail == NULL) {
+        queue_delete(&q.head);  // Cola inválida: head.data queda en NULL
+    }
+    return q;
+}
+
+/**
+ * Escribe el buffer tail completo como el segmento más nuevo.
+ *
+ * @param q Referencia a la cola, con tail lleno.
+ * @return `true` si el segmento se escribió, `false` si no se pudo crear o escribir el archivo.
+ */
+static bool queue_spill_out(QueueSpill* q) {
+    if (q->seg_first + q->n_segments == q->cap_segments) {
+        if (q->seg_first > 0) {
+            // Recorremos los segmentos pendientes al inicio en lugar de crecer
+            memmove(q->segments, q->segments + q->seg_first, q->n_segments * sizeof(FILE*));
+            q->seg_first = 0;
+        } else {
+            int cap = q->cap_segments == 0 ? 8 : q->cap_segments * 2;
+            FILE **segments = (FILE**)realloc(q->segments, cap * sizeof(FILE*));
+            if (segments == NULL) {
+                return false;
+            }
+            q->segments = segments;
+            q->cap_segments = cap;
+        }
+    }
+
+    FILE *f = tmpfile();  // El sistema borra el archivo al cerrarlo
+    if (f == NULL) {
+        return false;
+    }
+    if (fwrite(q->tail, sizeof(Data), q->tail_len, f) != (size_t)q->tail_len || fflush(f) != 0) {
+        fclose(f);
+        return false;
+    }
+    q->segments[q->seg_first + q->n_segments++] = f;
+    q->tail_len = 0;
+    return true;
+}
+
+/**
+ * Lee el segmento más viejo y lo agrega al final de head.
+ *
+ * @param q Referencia a la cola; head debe tener espacio para `segment` elementos más.
+ * @return `true` si se leyó, `false` si la lectura falló (el segmento se conserva).
+ * @details Se lee directo en el arreglo circular de head, con a lo más dos fread. Después se
+ *          le pide al sistema (posix_fadvise) que traiga a caché el siguiente segmento.
+ */
+static bool queue_spill_in(QueueSpill* q) {
+    Queue *h = &q->head;
+    FILE *f = q->segments[q->seg_first];
+    int first = q->segment < h->len - h->tail ? q->segment : h->len - h->tail;
+
+    rewind(f);
+    if (fread(h->data + h->tail, sizeof(Data), first, f) != (size_t)first
+        || fread(h->data, sizeof(Data), q->segment - first, f) != (size_t)(q->segment - first)) {
+        return false;
+    }
+    fclose(f);
+    h->tail = (h->tail + q->segment) % h->len;
+    h->size += q->segment;
+    QUEUE_STATS_ENQUEUED(h, q->segment);
+
+    q->seg_first++;
+    q->n_segments--;
+    if (q->n_segments == 0) {
+        q->seg_first = 0;
+    } else {
+        posix_fadvise(fileno(q->segments[q->seg_first]), 0, 0, POSIX_FADV_WILLNEED);
+    }
+    return true;
+}
+
+/**
+ * Mueve datos del disco y de tail hacia head mientras head tenga espacio para un segmento.
+ */
+static void queue_spill_refill(QueueSpill* q) {
+    while (q->head.size + q->segment <= q->head.len) {
+        if (q->n_segments > 0) {
+            if (!queue_spill_in(q)) {
+                return;
+            }
+        } else if (q->tail_len > 0) {
+            queue_enqueue_n(&q->head, q->tail, q->tail_len);
+            q->tail_len = 0;
+        } else {
+            return;
+        }
+    }
+}
+
+/**
+ * Inserta un elemento al final de la cola.
+ *
+ * @param q Referencia a la cola.
+ * @param d Dato que se insertará.
+ * @return `true` si se insertó, `false` si la memoria está llena y no se pudo escribir el segmento.
+ * @details Mientras no haya datos en disco ni en tail y head tenga espacio, el dato va directo
+ *          a head. Si no, va a tail, para no adelantarse a los datos pendientes.
+ */
+bool queue_spill_enqueue(QueueSpill* q, Data d) {
+    if (q == NULL || q->head.data == NULL) {
+        return false;
+    }
+    if (q->n_segments == 0 && q->tail_len == 0 && q->head.size < q->head.len) {
+        queue_enqueue(&q->head, d);
+        return true;
+    }
+    if (q->tail_len == q->segment && !queue_spill_out(q)) {
+        return false;
+    }
+    q->tail[q->tail_len++] = d;
+    return true;
+}
+
+/**
+ * Elimina y devuelve el elemento al frente de la cola.
+ *
+ * @param q Referencia a la cola.
+ * @return El dato del frente, o -1 si la cola está vacía.
+ */
+Data queue_spill_dequeue(QueueSpill* q) {
+    if (q == NULL || q->head.data == NULL) {
+        return -1;
+    }
+    queue_spill_refill(q);
+    return queue_dequeue(&q->head);
+}
+
+/**
+ * Verifica si la cola está vacía, contando los segmentos en disco.
+ */
+bool queue_spill_is_empty(QueueSpill* q) {
+    return q == NULL || (q->head.size == 0 && q->tail_len == 0 && q->n_segments == 0);
+}
+
+/**
+ * Devuelve la cantidad total de elementos, en memoria y en disco.
+ */
+long queue_spill_size(QueueSpill* q) {
+    if (q == NULL) {
+        return 0;
+    }
+    return (long)q->n_segments * q->segment + q->head.size + q->tail_len;
+}
+
+/**
+ * Elimina la cola: libera la memoria y cierra (y así borra) los segmentos en disco.
+ */
+void queue_spill_delete(QueueSpill* q) {
+    if (q == NULL) {
+        return;
+    }
+    for (int i = 0; i < q->n_segments; i++) {
+        fclose(q->segments[q->seg_first + i]);
+    }
+    free(q->segments);
+    free(q->tail);
+    q->segments = NULL;
+    q->tail = NULL;
+    q->tail_len = 0;
+    q->n_segments = 0;
+    q->seg_first = 0;
+    q->cap_segments = 0;
+    queue_delete(&q->head);
+}
@@ -0,0 +1,40 @@
+#ifndef __QUEUE_SPILL_H__
+#define __QUEUE_SPILL_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include "queue.h"
+
+/*
+ * Cola con presupuesto de memoria. Los dos extremos viven en memoria: `head`, una Queue normal
+ * de la que salen los dequeue, y `tail`, un buffer donde entran los enqueue mientras hay datos
+ * pendientes detrás de head. Cuando el buffer tail se llena, se escribe completo en un archivo
+ * temporal (un segmento) con una sola escritura secuencial. Los segmentos forman una cola FIFO
+ * con el tramo intermedio de los datos; cuando head baja a la mitad del presupuesto se lee el
+ * segmento más viejo (o, si no hay, el buffer tail) detrás de sus datos, antes de que se agote.
+ *
+ * Mientras la cola no excede el presupuesto, enqueue y dequeue van directo a head y el
+ * comportamiento es el de Queue.
+ */
+
+typedef struct {
+    Queue head;         // Elementos más viejos, en memoria; de aquí salen los dequeue
+    Data *tail;         // Elementos más recientes, en memoria, cuando hay datos detrás de head
+    int tail_len;
+    int budget;         // Máximo de elementos en memoria (head + tail)
+    int segment;        // Elementos por segmento en disco y capacidad de tail (budget / 4)
+    FILE **segments;    // Segmentos en disco: segments[seg_first .. seg_first + n_segments)
+    int seg_first;
+    int n_segments;
+    int cap_segments;
+} QueueSpill;
+
+QueueSpill queue_spill_create(size_t budget_bytes);
+bool queue_spill_enqueue(QueueSpill*, Data);
+Data queue_spill_dequeue(QueueSpill*);
+bool queue_spill_is_empty(QueueSpill*);
+long queue_spill_size(QueueSpill*);
+void queue_spill_delete(QueueSpill*);
+
+#endif // __QUEUE_SPILL_H__
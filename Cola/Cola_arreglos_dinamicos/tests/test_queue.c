@@ -1,5 +1,29 @@
+#define _POSIX_C_SOURCE 200809L  // mkstemp
 #include <check.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
 #include "../src/queue.h"
+#include "../src/queue_generic.h"
+#include "../src/queue_mmap.h"
+#include "../src/queue_spill.h"
+
+typedef struct {
+    long id;
+    int kind;
+    double value;
+} Message;
+
+typedef struct {
+    _Alignas(64) int value;
+} AlignedItem;
+
+DEFINE_QUEUE(MessageRing, Message, RING)
+DEFINE_QUEUE(MessageChunks, Message, CHUNK)
+DEFINE_QUEUE(AlignedRing, AlignedItem, RING)
 
 START_TEST(test_queue_init) {
     Queue queue = queue_create(5);
@@ -27,6 +51,307 @@ START_TEST(test_queue_enqueue_dequeue) {
 }
 END_TEST
 
+START_TEST(test_queue_grow_wrapped) {
+    Queue queue = queue_create(4);
+
+    // Desplazamos head para que los elementos den la vuelta antes de crecer
+    queue_enqueue(&queue, 1);
+    queue_enqueue(&queue, 2);
+    queue_enqueue(&queue, 3);
+    ck_assert_int_eq(queue_dequeue(&queue), 1);
+    ck_assert_int_eq(queue_dequeue(&queue), 2);
+    for (int i = 4; i <= 20; i++) {
+        queue_enqueue(&queue, i);
+    }
+    ck_assert_int_ge(queue.len, 18);
+
+    for (int i = 3; i <= 20; i++) {
+        ck_assert_int_eq(queue_dequeue(&queue), i);
+    }
+    ck_assert(queue_is_empty(&queue));
+    queue_delete(&queue);
+}
+END_TEST
+
+#ifdef QUEUE_STATS
+START_TEST(test_queue_stats) {
+    Queue q = queue_create(2);
+    Data in[10] = {0};
+
+    for (int i = 0; i < 100; i++) {
+        queue_enqueue(&q, i);
+    }
+    for (int i = 0; i < 30; i++) {
+        queue_dequeue(&q);
+    }
+    queue_enqueue_n(&q, in, 10);
+
+    QueueStats st = queue_stats(&q);
+    ck_assert_uint_eq(st.enqueues, 110);
+    ck_assert_uint_eq(st.dequeues, 30);
+    ck_assert_uint_eq(st.high_water, 100);
+    ck_assert_uint_eq(st.grows, 6);  // 2 -> 4 -> ... -> 128
+    ck_assert_uint_eq(st.allocs, 7);
+    ck_assert_uint_eq(st.bytes, 128 * sizeof(Data));
+    ck_assert_uint_eq(st.rejected, 0);
+
+    queue_delete(&q);
+    st = queue_stats(&q);
+    ck_assert_uint_eq(st.enqueues - st.dequeues, 0);
+    ck_assert_uint_eq(st.bytes, 0);
+}
+END_TEST
+#endif
+
+START_TEST(test_queue_enqueue_dequeue_n) {
+    Queue queue = queue_create(8);
+    Data in[100];
+    Data out[100];
+
+    for (int i = 0; i < 100; i++) {
+        in[i] = i;
+    }
+    // Desplazamos head para que el bloque dé la vuelta al anillo antes de crecer
+    ck_assert_int_eq(queue_enqueue_n(&queue, in, 6), 6);
+    ck_assert_int_eq(queue_dequeue_n(&queue, out, 5), 5);
+    ck_assert_int_eq(queue_enqueue_n(&queue, in + 6, 94), 94);
+    ck_assert_int_ge(queue.len, 95);
+
+    ck_assert_int_eq(queue_dequeue_n(&queue, out, 100), 95);
+    for (int i = 0; i < 95; i++) {
+        ck_assert_int_eq(out[i], i + 5);
+    }
+    ck_assert(queue_is_empty(&queue));
+
+    // size + n no cabe en un int: se rechaza sin tocar la cola ni leer `in`
+    queue_enqueue(&queue, 1);
+    int len = queue.len;
+    ck_assert_int_eq(queue_enqueue_n(&queue, in, INT_MAX), 0);
+    ck_assert_int_eq(queue.len, len);
+    ck_assert_int_eq(queue_dequeue(&queue), 1);
+    queue_delete(&queue);
+}
+END_TEST
+
+START_TEST(test_queue_generic) {
+    MessageRing ring = MessageRing_create(4);
+    MessageChunks chunks = MessageChunks_create(4);
+    Message m;
+
+    for (int i = 0; i < 200; i++) {
+        Message in = { i, i % 3, i * 0.5 };
+        ck_assert(MessageRing_enqueue(&ring, in));
+        ck_assert(MessageChunks_enqueue(&chunks, in));
+        if (i % 3 == 0) {
+            // Sacamos algunos en el camino para que el anillo dé la vuelta antes de crecer
+            ck_assert(MessageRing_dequeue(&ring, &m));
+            ck_assert(MessageChunks_dequeue(&chunks, &m));
+        }
+    }
+    ck_assert_int_eq(MessageRing_size(&ring), MessageChunks_size(&chunks));
+    int expected = MessageRing_front(&ring)->id;
+    while (!MessageRing_is_empty(&ring)) {
+        ck_assert(MessageRing_dequeue(&ring, &m));
+        ck_assert_int_eq(m.id, expected);
+        ck_assert(MessageChunks_dequeue(&chunks, &m));
+        ck_assert_int_eq(m.id, expected);
+        ck_assert(m.value == expected * 0.5);
+        expected++;
+    }
+    ck_assert_int_eq(expected, 200);
+    ck_assert(MessageChunks_is_empty(&chunks));
+    MessageRing_delete(&ring);
+    MessageChunks_delete(&chunks);
+
+    // Los tipos con alineación especial conservan su alineación al crecer
+    AlignedRing aligned = AlignedRing_create(1);
+    AlignedItem item = { 7 };
+    for (int i = 0; i < 10; i++) {
+        AlignedRing_enqueue(&aligned, item);
+    }
+    ck_assert_int_eq((uintptr_t)aligned.data % 64, 0);
+    ck_assert_int_eq(AlignedRing_front(&aligned)->value, 7);
+    AlignedRing_delete(&aligned);
+}
+END_TEST
+
+START_TEST(test_queue_mmap_persist) {
+    char path[] = "/tmp/test_queue_mmapXXXXXX";
+    int fd = mkstemp(path);
+    ck_assert_int_ge(fd, 0);
+    close(fd);
+
+    QueueMmapSync sync = { QUEUE_MMAP_SYNC_BATCH, 4, 0 };
+    QueueMmap *q = queue_mmap_create(path, 4, sync);
+    ck_assert_ptr_nonnull(q);
+
+    // Hacemos que el anillo dé la vuelta antes de crecer
+    for (int i = 0; i < 3; i++) {
+        queue_mmap_enqueue(q, i);
+    }
+    ck_assert_int_eq(queue_mmap_dequeue(q), 0);
+    ck_assert_int_eq(queue_mmap_dequeue(q), 1);
+    for (int i = 3; i < 20; i++) {
+        ck_assert(queue_mmap_enqueue(q, i));
+    }
+    queue_mmap_close(q);
+
+    // Al volver a abrir el archivo la cola sigue donde estaba; len se ignora
+    q = queue_mmap_create(path, 1, sync);
+    ck_assert_ptr_nonnull(q);
+    ck_assert_int_eq(queue_mmap_size(q), 18);
+    for (int i = 2; i < 20; i++) {
+        ck_assert_int_eq(queue_mmap_dequeue(q), i);
+    }
+    ck_assert(queue_mmap_is_empty(q));
+    queue_mmap_close(q);
+    unlink(path);
+}
+END_TEST
+
+START_TEST(test_queue_mmap_torn_grow) {
+    char path[] = "/tmp/test_queue_mmapXXXXXX";
+    int fd = mkstemp(path);
+    ck_assert_int_ge(fd, 0);
+    close(fd);
+
+    // Cola llena con el anillo dado la vuelta: len 4, head 2, tail 6; casillas {4, 5, 2, 3}
+    QueueMmapSync sync = { QUEUE_MMAP_SYNC_OP, 0, 0 };
+    QueueMmap *q = queue_mmap_create(path, 4, sync);
+    ck_assert_ptr_nonnull(q);
+    for (int i = 0; i < 4; i++) {
+        queue_mmap_enqueue(q, i);
+    }
+    queue_mmap_dequeue(q);
+    queue_mmap_dequeue(q);
+    queue_mmap_enqueue(q, 4);
+    queue_mmap_enqueue(q, 5);
+    queue_mmap_close(q);
+
+    // Simulamos lo que deja una caída a mitad de crecer a 8: archivo agrandado, tramo [2, 4)
+    // copiado a las casillas 6 y 7 y valores nuevos en grow_*, todavía sin confirmar
+    fd = open(path, O_RDWR);
+    ck_assert_int_ge(fd, 0);
+    QueueMmapHeader hdr;
+    ck_assert_int_eq(pread(fd, &hdr, sizeof(hdr), 0), sizeof(hdr));
+    ck_assert(hdr.len == 4 && hdr.head == 2 && hdr.tail == 6);
+    ck_assert_int_eq(ftruncate(fd, sizeof(hdr) + 8 * sizeof(Data)), 0);
+    Data front[2] = { 2, 3 };
+    ck_assert_int_eq(pwrite(fd, front, sizeof(front), sizeof(hdr) + 6 * sizeof(Data)),
+                     sizeof(front));
+    hdr.grow_len = 8;
+    hdr.grow_head = 6;
+    hdr.grow_tail = 10;
+    ck_assert_int_eq(pwrite(fd, &hdr, sizeof(hdr), 0), sizeof(hdr));
+
+    // Sin confirmar, la cola sigue como estaba
+    q = queue_mmap_create(path, 1, sync);
+    ck_assert_ptr_nonnull(q);
+    ck_assert_int_eq(queue_mmap_size(q), 4);
+    ck_assert_int_eq(queue_mmap_front(q), 2);
+    queue_mmap_close(q);
+
+    // Confirmado, pero la caída ocurrió después de escribir solo len: al abrir se completa
+    hdr.grow = 1;
+    hdr.len = 8;
+    ck_assert_int_eq(pwrite(fd, &hdr, sizeof(hdr), 0), sizeof(hdr));
+    close(fd);
+
+    q = queue_mmap_create(path, 1, sync);
+    ck_assert_ptr_nonnull(q);
+    ck_assert_int_eq(q->hdr->grow, 0);
+    ck_assert(q->hdr->len == 8);
+    ck_assert_int_eq(queue_mmap_size(q), 4);
+    ck_assert(queue_mmap_enqueue(q, 6));
+    for (int i = 2; i <= 6; i++) {
+        ck_assert_int_eq(queue_mmap_dequeue(q), i);
+    }
+    ck_assert(queue_mmap_is_empty(q));
+    queue_mmap_close(q);
+    unlink(path);
+}
+END_TEST
+
+START_TEST(test_queue_mmap_invalid_file) {
+    char path[] = "/tmp/test_queue_mmapXXXXXX";
+    int fd = mkstemp(path);
+    ck_assert_int_ge(fd, 0);
+    ck_assert_int_eq(write(fd, "no es una cola", 14), 14);
+    close(fd);
+
+    QueueMmapSync sync = { QUEUE_MMAP_SYNC_OP, 0, 0 };
+    ck_assert_ptr_null(queue_mmap_create(path, 4, sync));
+
+    // Un len corrupto tan grande que len * sizeof(Data) se desborda tampoco se acepta
+    unlink(path);
+    QueueMmap *q = queue_mmap_create(path, 4, sync);
+    ck_assert_ptr_nonnull(q);
+    queue_mmap_close(q);
+    fd = open(path, O_RDWR);
+    ck_assert_int_ge(fd, 0);
+    QueueMmapHeader hdr;
+    ck_assert_int_eq(pread(fd, &hdr, sizeof(hdr), 0), sizeof(hdr));
+    hdr.len = UINT64_MAX / sizeof(Data) + 2;
+    ck_assert_int_eq(pwrite(fd, &hdr, sizeof(hdr), 0), sizeof(hdr));
+    close(fd);
+    ck_assert_ptr_null(queue_mmap_create(path, 4, sync));
+    unlink(path);
+}
+END_TEST
+
+START_TEST(test_queue_spill) {
+    QueueSpill q = queue_spill_create(16 * sizeof(Data));
+    int next_in = 0;
+    int next_out = 0;
+
+    for (; next_in < 1000; next_in++) {
+        ck_assert(queue_spill_enqueue(&q, next_in));
+    }
+    ck_assert_int_eq(queue_spill_size(&q), 1000);
+    ck_assert_int_le(q.head.size + q.tail_len, 16);  // Nunca más del presupuesto en memoria
+    ck_assert_int_gt(q.n_segments, 0);
+
+    // Alternamos extracciones e inserciones mientras hay datos en disco
+    for (int round = 0; round < 50; round++) {
+        for (int i = 0; i < 7; i++) {
+            ck_assert_int_eq(queue_spill_dequeue(&q), next_out++);
+        }
+        for (int i = 0; i < 3; i++) {
+            ck_assert(queue_spill_enqueue(&q, next_in++));
+        }
+    }
+    while (!queue_spill_is_empty(&q)) {
+        ck_assert_int_eq(queue_spill_dequeue(&q), next_out++);
+    }
+    ck_assert_int_eq(next_out, next_in);
+    ck_assert_int_eq(q.n_segments, 0);
+    queue_spill_delete(&q);
+}
+END_TEST
+
+START_TEST(test_queue_try_dequeue) {
+    Queue queue = queue_create(2);
+    Data d = 99;
+
+    ck_assert(!queue_try_dequeue(&queue, &d));
+    ck_assert_int_eq(d, 99);  // Sin datos, out no cambia
+
+    // -1 es un dato como cualquier otro: try_dequeue lo distingue de una cola vacía
+    queue_enqueue(&queue, -1);
+    queue_enqueue(&queue, 5);
+    queue_enqueue(&queue, 6);
+    ck_assert(queue_try_dequeue(&queue, &d));
+    ck_assert_int_eq(d, -1);
+    ck_assert(queue_try_dequeue(&queue, &d));
+    ck_assert_int_eq(d, 5);
+    ck_assert(queue_try_dequeue(&queue, &d));
+    ck_assert_int_eq(d, 6);
+    ck_assert(!queue_try_dequeue(&queue, &d));
+    ck_assert(queue_is_empty(&queue));
+    queue_delete(&queue);
+}
+END_TEST
+
 Suite* queue_suite(void) {
     Suite* s;
     TCase* tc_core;
@@ -36,6 +361,17 @@ Suite* queue_suite(void) {
     tc_core = tcase_create("Core");
     tcase_add_test(tc_core, test_queue_init);
     tcase_add_test(tc_core, test_queue_enqueue_dequeue);
+    tcase_add_test(tc_core, test_queue_grow_wrapped);
+#ifdef QUEUE_STATS
+    tcase_add_test(tc_core, test_queue_stats);
+#endif
+    tcase_add_test(tc_core, test_queue_enqueue_dequeue_n);
+    tcase_add_test(tc_core, test_queue_generic);
+    tcase_add_test(tc_core, test_queue_mmap_persist);
+    tcase_add_test(tc_core, test_queue_mmap_torn_grow);
+    tcase_add_test(tc_core, test_queue_mmap_invalid_file);
+    tcase_add_test(tc_core, test_queue_spill);
+    tcase_add_test(tc_core, test_queue_try_dequeue);
     suite_add_tcase(s, tc_core);
 
     return s;
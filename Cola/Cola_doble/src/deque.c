@@ -0,0 +1,290 @@
+#include "deque.h"
+#include <stdlib.h>
+#include <string.h>
+
+_Static_assert((DEQUE_BLOCK_LEN & (DEQUE_BLOCK_LEN - 1)) == 0, "DEQUE_BLOCK_LEN debe ser potencia de dos");
+
+// Bloque y desplazamiento de la posición p del arreglo virtual (p >= 0)
+#define DEQUE_BLOCK(p) ((unsigned)(p) / DEQUE_BLOCK_LEN)
+#define DEQUE_OFFSET(p) ((unsigned)(p) % DEQUE_BLOCK_LEN)
+
+// Posición inicial del primer dato: el comienzo del bloque central del mapa
+#define DEQUE_CENTER(d) ((d)->map_len / 2 * DEQUE_BLOCK_LEN)
+
+/**
+ * Crea una nueva cola doble vacía.
+ *
+ * @return Una nueva cola vacía. Si la creación falla, map es NULL.
+ * @details Solo se reserva el mapa; los bloques se reservan cuando reciben su primer dato.
+ */
+Deque deque_create(void) {
+    Deque d;
+    memset(&d, 0, sizeof(Deque));
+    d.map = (Data**)calloc(DEQUE_MIN_MAP, sizeof(Data*));
+    if (d.map != NULL) {
+        d.map_len = DEQUE_MIN_MAP;
+        d.head = DEQUE_CENTER(&d);
+    }
+    return d;
+}
+
+/**
+ * Obtiene un bloque para datos nuevos, reutilizando el bloque libre si lo hay.
+ *
+ * @return El bloque, o NULL si no hubo memoria.
+ */
+static Data* deque_block_new(Deque* d) {
+    Data *block = d->spare;
+    if (block != NULL) {
+        d->spare = NULL;
+        return block;
+    }
+    return (Data*)malloc(DEQUE_BLOCK_LEN * sizeof(Data));
+}
+
+/**
+ * Devuelve un bloque que quedó sin datos: se guarda como bloque libre o se libera.
+ */
+static void deque_block_release(Deque* d, Data* block) {
+    if (d->spare == NULL) {
+        d->spare = block;
+    } else {
+        free(block);
+    }
+}
+
+/**
+ * Hace espacio en el mapa cuando los datos alcanzaron uno de sus extremos.
+ *
+ * @param d Referencia a la cola.
+ * @return `true` si hay espacio en ambos extremos, `false` si no hubo memoria (la cola no cambia).
+ * @details Si los bloques ocupados llenan más de la mitad del mapa, el mapa se duplica; en
+ *          otro caso solo se recentran. En ambos casos se mueven apuntadores a bloques, nunca
+ *          los datos, y quedan libres al menos tantos bloques a cada lado como los que
+ *          ocupaban los datos, así que el costo se amortiza en O(1) por operación.
+ */
+static bool deque_remap(Deque* d) {
+    int first = DEQUE_BLOCK(d->head);
+    int used = d->size == 0 ? 0 : (int)DEQUE_BLOCK(d->head + d->size - 1) - first + 1;
+    int len = d->map_len;
+
+    if (2 * (used + 1) > len) {
+        Data **map = (Data**)realloc(d->map, 2 * len * sizeof(Data*));
+        if (map == NULL) {
+            return false;
+        }
+        d->map = map;
+        len *= 2;
+    }
+
+    int new_first = (len - used) / 2;
+    memmove(d->map + new_first, d->map + first, used * sizeof(Data*));
+    for (int i = 0; i < new_first; i++) {
+        d->map[i] = NULL;
+    }
+    for (int i = new_first + used; i < len; i++) {
+        d->map[i] = NULL;
+    }
+    d->head = new_first * DEQUE_BLOCK_LEN + DEQUE_OFFSET(d->head);
+    d->map_len = len;
+    return true;
+}
+
+/**
+ * Guarda el dato x en la posición p, reservando su bloque si todavía no existe.
+ *
+ * @return `true` si se guardó, `false` si no hubo memoria para el bloque.
+ */
+static bool deque_store(Deque* d, int p, Data x) {
+    Data **block = &d->map[DEQUE_BLOCK(p)];
+    if (*block == NULL) {
+        *block = deque_block_new(d);
+        if (*block == NULL) {
+            return false;
+        }
+    }
+    (*block)[DEQUE_OFFSET(p)] = x;
+    return true;
+}
+
+/**
+ * Inserta un dato al frente de la cola.
+ *
+ * @param d Referencia a la cola.
+ * @param x Dato que se insertará.
+ * @return `true` si se insertó, `false` si no hubo memoria.
+ */
+bool deque_push_front(Deque* d, Data x) {
+    if (d == NULL || d->map == NULL) {
+        return false;
+    }
+    if (d->head == 0 && !deque_remap(d)) {
+        return false;
+    }
+    if (!deque_store(d, d->head - 1, x)) {
+        return false;
+    }
+    d->head--;
+    d->size++;
+    return true;
+}
+
+/**
+ * Inserta un dato al final de la cola.
+ *
+ * @param d Referencia a la cola.
+ * @param x Dato que se insertará.
+ * @return `true` si se insertó, `false` si no hubo memoria.
+ */
+bool deque_push_back(Deque* d, Data x) {
+    if (d == NULL || d->map == NULL) {
+        return false;
+    }
+    if (d->head + d->size == d->map_len * DEQUE_BLOCK_LEN && !deque_remap(d)) {
+        return false;
+    }
+    if (!deque_store(d, d->head + d->size, x)) {
+        return false;
+    }
+    d->size++;
+    return true;
+}
+
+/**
+ * Libera el bloque de la posición p, que acaba de quedar sin datos. Si la cola quedó vacía,
+ * el primer dato vuelve al centro del mapa.
+ */
+static void deque_drop_block(Deque* d, int p) {
+    deque_block_release(d, d->map[DEQUE_BLOCK(p)]);
+    d->map[DEQUE_BLOCK(p)] = NULL;
+    if (d->size == 0) {
+        d->head = DEQUE_CENTER(d);
+    }
+}
+
+/**
+ * Elimina y devuelve el dato al frente de la cola.
+ *
+ * @param d Referencia a la cola.
+ * @return El dato al frente, o -1 si la cola está vacía.
+ */
+Data deque_pop_front(Deque* d) {
+    if (deque_is_empty(d)) {
+        return -1;
+    }
+    int p = d->head;
+    Data x = d->map[DEQUE_BLOCK(p)][DEQUE_OFFSET(p)];
+    d->head++;
+    d->size--;
+    if (d->size == 0 || DEQUE_OFFSET(d->head) == 0) {
+        deque_drop_block(d, p);
+    }
+    return x;
+}
+
+/**
+ * Elimina y devuelve el dato al final de la cola.
+ *
+ * @param d Referencia a la cola.
+ * @return El dato al final, o -1 si la cola está vacía.
+ */
+Data deque_pop_back(Deque* d) {
+    if (deque_is_empty(d)) {
+        return -1;
+    }
+    int p = d->head + d->size - 1;
+    Data x = d->map[DEQUE_BLOCK(p)][DEQUE_OFFSET(p)];
+    d->size--;
+    if (d->size == 0 || DEQUE_OFFSET(p) == 0) {
+        deque_drop_block(d, p);
+    }
+    return x;
+}
+
+/**
+ * Devuelve el dato al frente de la cola sin eliminarlo.
+ *
+ * @return El dato al frente, o -1 si la cola está vacía.
+ */
+Data deque_front(Deque* d) {
+    if (deque_is_empty(d)) {
+        return -1;
+    }
+    return d->map[DEQUE_BLOCK(d->head)][DEQUE_OFFSET(d->head)];
+}
+
+/**
+ * Devuelve el dato al final de la cola sin eliminarlo.
+ *
+ * @return El dato al final, o -1 si la cola está vacía.
+ */
+Data deque_back(Deque* d) {
+    if (deque_is_empty(d)) {
+        return -1;
+    }
+    int p = d->head + d->size - 1;
+    return d->map[DEQUE_BLOCK(p)][DEQUE_OFFSET(p)];
+}
+
+/**
+ * Accede al dato en la posición i, contando desde el frente, en tiempo O(1).
+ *
+ * @param d Referencia a la cola.
+ * @param i Posición del dato, de 0 a size - 1.
+ * @return Un apuntador al dato, o NULL si i está fuera de rango. El apuntador sigue siendo
+ *         válido mientras el dato esté en la cola, aunque se inserten o eliminen otros datos.
+ */
+Data* deque_at(Deque* d, int i) {
+    if (d == NULL || i < 0 || i >= d->size) {
+        return NULL;
+    }
+    int p = d->head + i;
+    return &d->map[DEQUE_BLOCK(p)][DEQUE_OFFSET(p)];
+}
+
+/**
+ * Verifica si la cola está vacía.
+ *
+ * @return `true` si la cola está vacía o es inválida.
+ */
+bool deque_is_empty(Deque* d) {
+    return d == NULL || d->map == NULL || d->size == 0;
+}
+
+/**
+ * Devuelve la cantidad de datos en la cola.
+ */
+int deque_size(Deque* d) {
+    return d == NULL ? 0 : d->size;
+}
+
+/**
+ * Vacía la cola; se liberan sus bloques y se conserva el mapa.
+ */
+void deque_empty(Deque* d) {
+    if (deque_is_empty(d)) {
+        return;
+    }
+    int last = DEQUE_BLOCK(d->head + d->size - 1);
+    for (int i = DEQUE_BLOCK(d->head); i <= last; i++) {
+        deque_block_release(d, d->map[i]);
+        d->map[i] = NULL;
+    }
+    d->size = 0;
+    d->head = DEQUE_CENTER(d);
+}
+
+/**
+ * Elimina la cola y libera la memoria asociada a ella.
+ *
+ * @param d Referencia a la cola que se desea eliminar.
+ */
+void deque_delete(Deque* d) {
+    if (d == NULL) {
+        return;
+    }
+    deque_empty(d);
+    free(d->spare);
+    free(d->map);
+    memset(d, 0, sizeof(Deque));
+}
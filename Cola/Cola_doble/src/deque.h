@@ -0,0 +1,43 @@
+#ifndef __DEQUE_H__
+#define __DEQUE_H__
+
+#include <stdbool.h>
+
+typedef int Data;
+
+// Cantidad de datos de cada bloque; debe ser potencia de dos.
+// Puede cambiarse al compilar, por ejemplo con -DDEQUE_BLOCK_LEN=16
+#ifndef DEQUE_BLOCK_LEN
+#define DEQUE_BLOCK_LEN 256
+#endif
+
+// Capacidad inicial del mapa de bloques
+#define DEQUE_MIN_MAP 8
+
+// Cola doble formada por bloques de DEQUE_BLOCK_LEN datos y un mapa de apuntadores a ellos
+// (la misma organización que std::deque). Los datos ocupan las posiciones head .. head+size-1
+// de un arreglo virtual; la posición p está en map[p / DEQUE_BLOCK_LEN][p % DEQUE_BLOCK_LEN].
+// Solo están reservados los bloques que contienen algún dato; los demás apuntadores son NULL.
+// Crecer solo mueve apuntadores del mapa, nunca los datos, así que sus direcciones no cambian.
+typedef struct {
+    Data **map;   // Apuntadores a los bloques
+    int map_len;  // Capacidad del mapa
+    int head;     // Posición del primer dato en el arreglo virtual
+    int size;     // Cantidad de datos
+    Data *spare;  // Bloque libre guardado para no liberar y reservar al oscilar en un borde
+} Deque;
+
+Deque deque_create(void);
+bool deque_push_front(Deque*, Data);
+bool deque_push_back(Deque*, Data);
+Data deque_pop_front(Deque*);
+Data deque_pop_back(Deque*);
+Data deque_front(Deque*);
+Data deque_back(Deque*);
+Data* deque_at(Deque*, int);
+bool deque_is_empty(Deque*);
+int deque_size(Deque*);
+void deque_empty(Deque*);
+void deque_delete(Deque*);
+
+#endif // __DEQUE_H__
@@ -0,0 +1,144 @@
+#include <check.h>
+#include <stdlib.h>
+#include "../src/deque.h"
+
+START_TEST(test_deque_init) {
+    Deque d = deque_create();
+    ck_assert_ptr_nonnull(d.map);
+    ck_assert(deque_is_empty(&d));
+    ck_assert_int_eq(deque_pop_front(&d), -1);
+    ck_assert_int_eq(deque_pop_back(&d), -1);
+    ck_assert_ptr_null(deque_at(&d, 0));
+    deque_delete(&d);
+    ck_assert_ptr_null(d.map);
+}
+END_TEST
+
+START_TEST(test_deque_both_ends) {
+    Deque d = deque_create();
+    int n = 5000;
+
+    // Pares al final y nones al frente: el mapa crece hacia ambos lados
+    for (int i = 0; i < n; i++) {
+        ck_assert(deque_push_back(&d, 2 * i));
+        ck_assert(deque_push_front(&d, 2 * i + 1));
+    }
+    ck_assert_int_eq(deque_size(&d), 2 * n);
+    ck_assert_int_eq(deque_front(&d), 2 * n - 1);
+    ck_assert_int_eq(deque_back(&d), 2 * n - 2);
+
+    for (int i = n - 1; i >= 0; i--) {
+        ck_assert_int_eq(deque_pop_front(&d), 2 * i + 1);
+        ck_assert_int_eq(deque_pop_back(&d), 2 * i);
+    }
+    ck_assert(deque_is_empty(&d));
+
+    // Usada como pila desde cualquiera de los extremos
+    for (int i = 0; i < n; i++) {
+        deque_push_front(&d, i);
+    }
+    for (int i = 0; i < n; i++) {
+        ck_assert_int_eq(deque_pop_back(&d), i);
+    }
+    ck_assert(deque_is_empty(&d));
+    deque_delete(&d);
+}
+END_TEST
+
+START_TEST(test_deque_at_stable) {
+    Deque d = deque_create();
+    int n = 3000;
+    for (int i = 0; i < n; i++) {
+        deque_push_back(&d, i);
+    }
+    Data* first = deque_at(&d, 0);
+    Data* last = deque_at(&d, n - 1);
+    ck_assert_ptr_null(deque_at(&d, n));
+
+    // Crecer por ambos lados no mueve los datos que ya estaban
+    for (int i = 1; i <= 10 * n; i++) {
+        deque_push_front(&d, -i);
+        deque_push_back(&d, n + i - 1);
+    }
+    ck_assert_ptr_eq(deque_at(&d, 10 * n), first);
+    ck_assert_ptr_eq(deque_at(&d, 11 * n - 1), last);
+    ck_assert_int_eq(*first, 0);
+    ck_assert_int_eq(*last, n - 1);
+
+    // Acceso indexado en O(1) a cualquier posición
+    for (int i = 0; i < deque_size(&d); i++) {
+        ck_assert_int_eq(*deque_at(&d, i), i - 10 * n);
+    }
+
+    deque_empty(&d);
+    ck_assert(deque_is_empty(&d));
+    ck_assert(deque_push_back(&d, 7));
+    ck_assert_int_eq(deque_front(&d), 7);
+    deque_delete(&d);
+}
+END_TEST
+
+START_TEST(test_deque_sliding_window) {
+    // Máximo de cada ventana de k datos: la cola guarda índices con valores decrecientes
+    int n = 20000, k = 37;
+    Data* in = (Data*)malloc(n * sizeof(Data));
+    unsigned rng = 2024;
+    for (int i = 0; i < n; i++) {
+        rng = rng * 1103515245u + 12345u;
+        in[i] = (rng >> 16) % 1000;
+    }
+
+    Deque d = deque_create();
+    for (int i = 0; i < n; i++) {
+        while (!deque_is_empty(&d) && in[deque_back(&d)] <= in[i]) {
+            deque_pop_back(&d);
+        }
+        deque_push_back(&d, i);
+        if (deque_front(&d) <= i - k) {
+            deque_pop_front(&d);
+        }
+        if (i >= k - 1) {
+            Data expected = in[i];
+            for (int j = i - k + 1; j < i; j++) {
+                expected = in[j] > expected ? in[j] : expected;
+            }
+            ck_assert_int_eq(in[deque_front(&d)], expected);
+        }
+    }
+    // La ventana avanza sin que el mapa crezca sin límite
+    ck_assert_int_le(d.map_len, 2 * DEQUE_MIN_MAP + (k / DEQUE_BLOCK_LEN + 2) * 4);
+    deque_delete(&d);
+    free(in);
+}
+END_TEST
+
+Suite* deque_suite(void) {
+    Suite* s;
+    TCase* tc_core;
+
+    s = suite_create("Deque");
+
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, test_deque_init);
+    tcase_add_test(tc_core, test_deque_both_ends);
+    tcase_add_test(tc_core, test_deque_at_stable);
+    tcase_add_test(tc_core, test_deque_sliding_window);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int number_failed;
+    Suite* s;
+    SRunner* sr;
+
+    s = deque_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+
+    return (number_failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,31 @@
+#ifndef __ARENA_H__
+#define __ARENA_H__
+#include <stddef.h>
+
+// Tamaño de cada bloque que la arena pide a malloc; una petición mayor recibe su propio bloque
+#define ARENA_BLOCK_SIZE 65536
+
+// Alineación de cada reserva, suficiente para cualquier tipo básico
+#define ARENA_ALIGN 16
+
+// Bloque de la arena; sus datos empiezan en el primer múltiplo de ARENA_ALIGN tras el encabezado
+typedef struct ArenaBlock {
+    struct ArenaBlock* next;
+    size_t size;  // Bytes de datos del bloque
+} ArenaBlock;
+
+// Arena de reserva por desplazamiento (bump allocator): cada reserva solo avanza cur. No hay
+// liberación individual; `arena_release` libera todos los bloques a la vez, sin importar
+// cuántos objetos se reservaron en ellos.
+typedef struct {
+    ArenaBlock* blocks;  // Bloques reservados, el más reciente primero
+    char* cur;           // Siguiente byte libre del bloque más reciente
+    char* end;           // Fin del bloque más reciente
+} Arena;
+
+void arena_init(Arena*);
+void* arena_alloc(Arena*, size_t);
+void arena_reset(Arena*);
+void arena_release(Arena*);
+
+#endif // __ARENA_H__
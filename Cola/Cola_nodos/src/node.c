@@ -2,37 +2,93 @@
 #include <stdlib.h>
 #include <stdio.h>
 
+// Bloque de nodos contiguos; los bloques se encadenan para poder liberarlos al final
+typedef struct Slab {
+    struct Slab* next;
+    Node nodes[NODE_SLAB_SIZE];
+} Slab;
+
+static Slab *slabs = NULL;       // Bloques reservados hasta ahora
+static Node *free_nodes = NULL;  // Lista libre intrusiva: los nodos libres se enlazan por su campo next
+
+/**
+ * Reserva un nuevo bloque de nodos y los agrega a la lista libre.
+ * 
+ * @return 1 si se pudo reservar el bloque, 0 si malloc falló.
+ * @details Los nodos se enlazan en orden de dirección para que nodos creados uno tras otro
+ *          queden contiguos en memoria.
+ */
+static int slab_refill(void) {
+    Slab *slab = (Slab*)malloc(sizeof(Slab));
+    if (slab == NULL) {
+        return 0;
+    }
+
+    slab->next = slabs;
+    slabs = slab;
+    for (int i = NODE_SLAB_SIZE - 1; i >= 0; i--) {
+        slab->nodes[i].next = free_nodes;
+        free_nodes = &slab->nodes[i];
+    }
+    return 1;
+}
+
 /**
  * Crea un nuevo nodo con los datos proporcionados y lo devuelve.
  * 
  * @param d Dato que se almacenará en el nuevo nodo.
  * @return Un apuntador al nuevo nodo creado. Si la creación falla, devuelve NULL.
- * @details Esta función asigna memoria dinámicamente para un nuevo nodo utilizando `malloc`.
+ * @details El nodo creado contiene un solo dato, `d`, en la primera posición. El nodo se toma de la lista libre del allocator de bloques; solo cuando la lista está
+ *          vacía se llama a `malloc` para reservar un bloque de NODE_SLAB_SIZE nodos.
  *          Si la asignación de memoria falla, la función devuelve NULL. El nodo creado
- *          tiene sus campos inicializados, y el campo de datos se establece con el valor
- *          proporcionado en el parámetro `d`, el siguiente .
+ *          tiene sus campos inicializados y el siguiente es NULL.
  */
 Node *new_node(Data d) {
-    // Asignamos memoria para un nuevo nodo
-    Node *n = (Node*)malloc(sizeof(Node));
-    if (n == NULL) {
+    if (free_nodes == NULL && !slab_refill()) {
         // Si la asignación falla, devolvemos NULL
         return NULL;
     }
 
+    // Tomamos el primer nodo de la lista libre
+    Node *n = free_nodes;
+    free_nodes = n->next;
+
     // Inicializamos el nodo con el valor proporcionado en d
-    n->data = d;
+    n->data[0] = d;
+    n->head = 0;
+    n->tail = 1;
     n->next = NULL;  // El siguiente nodo es NULL al principio
 
     return n;
 }
 
 /**
- * Elimina un nodo y libera la memoria asociada a él.
+ * Crea un nuevo nodo reservado en una arena.
+ * 
+ * @param a Arena de la que se toma la memoria.
+ * @param d Dato que se almacenará en la primera posición del nodo.
+ * @return Un apuntador al nuevo nodo, con su siguiente en NULL. Si la creación falla, devuelve NULL.
+ * @details El nodo no pasa por la lista libre: no debe entregarse a `delete_node`, se libera
+ *          junto con todo lo demás al llamar a `arena_release`.
+ */
+Node *new_node_in(Arena* a, Data d) {
+    Node *n = (Node*)arena_alloc(a, sizeof(Node));
+    if (n == NULL) {
+        return NULL;
+    }
+    n->data[0] = d;
+    n->head = 0;
+    n->tail = 1;
+    n->next = NULL;
+    return n;
+}
+
+/**
+ * Elimina un nodo y lo devuelve a la lista libre.
  * 
  * @param n Apuntador al nodo que se desea eliminar.
- * @details Esta función libera la memoria asignada dinámicamente para el nodo utilizando `free`.
- *          Si el apuntador pasado es NULL, la función no realiza ninguna operación.
+ * @details El nodo no se libera con `free`, se recicla en la lista libre para la siguiente
+ *          llamada a `new_node`. Si el apuntador pasado es NULL, la función no realiza ninguna operación.
  *          Es responsabilidad del llamante asegurarse de que el nodo ya no se utiliza después
  *          de ser eliminado. Está función solo libera nodos cuyo enlace al siguiente es nulo
  */
@@ -42,15 +98,31 @@ void delete_node(Node* n) {
         return;
     }
 
-    // Liberamos la memoria del nodo
-    free(n);
+    // Reciclamos el nodo en la lista libre
+    n->next = free_nodes;
+    free_nodes = n;
+}
+
+/**
+ * Libera todos los bloques reservados por el allocator de nodos.
+ * 
+ * @details Solo debe llamarse cuando ya no queda ningún nodo en uso (por ejemplo, al terminar
+ *          el programa), porque invalida todos los nodos creados con `new_node`.
+ */
+void node_pool_release(void) {
+    while (slabs != NULL) {
+        Slab *next = slabs->next;
+        free(slabs);
+        slabs = next;
+    }
+    free_nodes = NULL;
 }
 
 /**
  * Imprime la información contenida en un nodo.
  * 
  * @param n Apuntador al nodo que se desea imprimir.
- * @details Esta función imprime los campos del nodo, como su valor y punteros a otros nodos,
+ * @details Esta función imprime los campos del nodo, como sus datos y punteros a otros nodos,
  *          en un formato legible. Si el puntero pasado es NULL, la función imprime un mensaje
  *          indicando que el nodo es inválido. La salida se dirige a la salida estándar (stdout).
  */
@@ -61,6 +133,10 @@ void print_node(Node* n) {
         return;
     }
 
-    // Imprimimos el valor del nodo y el puntero al siguiente nodo
-    printf("Nodo: %p, Dato: %d, Siguiente: %p\n", (void*)n, n->data, (void*)n->next);
+    // Imprimimos los datos válidos del nodo y el puntero al siguiente nodo
+    printf("Nodo: %p, Datos:", (void*)n);
+    for (int i = n->head; i < n->tail; i++) {
+        printf(" %d", n->data[i]);
+    }
+    printf(", Siguiente: %p\n", (void*)n->next);
 }
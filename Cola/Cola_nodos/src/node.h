@@ -1,14 +1,28 @@
 #ifndef __NODE_H__
 #define __NODE_H__
+#include "arena.h"
+
+// Cantidad de datos que guarda cada nodo; con 60 enteros un nodo ocupa 256 bytes (4 líneas de caché)
+#define NODE_CAPACITY 60
+
+// Cantidad de nodos que se reservan juntos en cada bloque (slab)
+#define NODE_SLAB_SIZE 16
 
 typedef int Data;
+
+// Nodo de una lista desenrollada: guarda un tramo de hasta NODE_CAPACITY datos.
+// Los datos válidos están en data[head .. tail - 1].
 typedef struct Node {
-    Data data;
+    Data data[NODE_CAPACITY];
+    int head;  // Posición del primer dato válido dentro del nodo
+    int tail;  // Posición siguiente al último dato válido dentro del nodo
     struct Node* next;
 } Node;
 
 Node *new_node(Data);
+Node *new_node_in(Arena*, Data);
 void delete_node(Node*);
 void print_node(Node*);
+void node_pool_release(void);
 
-#endif
\ No newline at end of file
+#endif
@@ -1,30 +1,225 @@
 #include "queue.h"
 #include <stdlib.h>
+#include <string.h>
 
-Queue* queue_create(){
+// Versiones normales (no inline) de las operaciones frecuentes
+#ifndef QUEUE_HEADER_ONLY
+#define QUEUE_INLINE
+#include "queue_inline.h"
+#endif
 
+/**
+ * Crea una nueva cola vacía y la devuelve.
+ * 
+ * @return Un apuntador a la nueva cola creada. Si la creación falla, devuelve NULL.
+ * @details Esta función asigna memoria dinámicamente para la cola utilizando `malloc`.
+ *          La cola creada está vacía, head y tail apuntan a NULL.
+ */
+Queue* queue_create(){
+    Queue *q = (Queue*)malloc(sizeof(Queue));
+    if (q == NULL) {
+        return NULL;
+    }
+    q->head = NULL;
+    q->tail = NULL;
+    q->arena = NULL;
+    q->recycled = NULL;
+#ifdef QUEUE_STATS
+    q->stats = (QueueStats){0};
+#endif
+    return q;
 }
 
-void queue_enqueue(Queue* q, Data d){
-
+/**
+ * Crea una nueva cola vacía dentro de una arena.
+ * 
+ * @param a Arena de la que se reservan la cola y todos sus nodos.
+ * @return Un apuntador a la nueva cola. Si la creación falla, devuelve NULL.
+ * @details Los nodos nuevos se toman de la arena por desplazamiento en lugar de llamar a
+ *          malloc, y los que se agotan se reutilizan en la misma cola. `queue_delete` no
+ *          recorre los nodos: la cola completa se libera con `arena_release`, junto con todo
+ *          lo demás que se haya creado en la arena.
+ */
+Queue* queue_create_in(Arena* a){
+    Queue *q = (Queue*)arena_alloc(a, sizeof(Queue));
+    if (q == NULL) {
+        return NULL;
+    }
+    q->head = NULL;
+    q->tail = NULL;
+    q->arena = a;
+    q->recycled = NULL;
+#ifdef QUEUE_STATS
+    q->stats = (QueueStats){0};
+#endif
+    return q;
 }
 
-Data queue_dequeue(Queue* q){
+/**
+ * Inserta varios elementos al final de la cola, en orden.
+ * 
+ * @param q Apuntador a la cola donde se insertarán los elementos.
+ * @param in Arreglo con los datos a insertar.
+ * @param n Cantidad de datos en `in`.
+ * @return Cantidad de datos insertados, menor que n si no se pudieron crear más nodos.
+ * @details Primero llena con `memcpy` el espacio libre del nodo tail. Los datos restantes se
+ *          copian en una cadena de nodos nuevos armada aparte, que se enlaza a la cola al final.
+ */
+int queue_enqueue_n(Queue* q, const Data* in, int n){
+    if (q == NULL || in == NULL || n <= 0) {
+        return 0;
+    }
 
-}
+    int count = 0;
+    if (q->tail != NULL) {
+        int room = NODE_CAPACITY - q->tail->tail;
+        count = n < room ? n : room;
+        memcpy(&q->tail->data[q->tail->tail], in, count * sizeof(Data));
+        q->tail->tail += count;
+    }
 
-bool queue_is_empty(Queue* q){
+    Node *first = NULL;  // Cadena de nodos nuevos
+    Node *last = NULL;
+    while (count < n) {
+        Node *node = queue_node_new(q, in[count]);
+        if (node == NULL) {
+            break;  // Sin memoria: enlazamos lo que alcanzamos a copiar
+        }
+        int chunk = n - count < NODE_CAPACITY ? n - count : NODE_CAPACITY;
+        memcpy(&node->data[1], in + count + 1, (chunk - 1) * sizeof(Data));
+        node->tail = chunk;
+        count += chunk;
+        QUEUE_STATS_ADD(q, allocs, 1);
+        QUEUE_STATS_ADD(q, bytes, sizeof(Node));
+        if (last == NULL) {
+            first = node;
+        } else {
+            last->next = node;
+        }
+        last = node;
+    }
 
+    if (first != NULL) {
+        if (q->tail == NULL) {
+            q->head = first;
+        } else {
+            q->tail->next = first;
+        }
+        q->tail = last;
+    }
+    QUEUE_STATS_ENQUEUED(q, count);
+    QUEUE_STATS_ADD(q, rejected, n - count);
+    return count;
 }
 
-Data queue_front(Queue* q){
+/**
+ * Extrae varios elementos del frente de la cola, en orden.
+ * 
+ * @param q Apuntador a la cola de la cual se extraerán los elementos.
+ * @param out Arreglo donde se guardan los datos extraídos.
+ * @param n Cantidad máxima de datos a extraer.
+ * @return Cantidad de datos extraídos, menor que n si la cola se vació.
+ * @details Copia con un `memcpy` por nodo y libera los nodos que se agotan, igual que
+ *          `queue_dequeue`.
+ */
+int queue_dequeue_n(Queue* q, Data* out, int n){
+    if (out == NULL || n <= 0) {
+        return 0;
+    }
 
+    int count = 0;
+    while (count < n && !queue_is_empty(q)) {
+        Node *front = q->head;
+        int available = front->tail - front->head;
+        int chunk = n - count < available ? n - count : available;
+        memcpy(out + count, &front->data[front->head], chunk * sizeof(Data));
+        front->head += chunk;
+        count += chunk;
+        if (front->head == front->tail) {
+            if (front == q->tail) {
+                front->head = 0;  // Único nodo: lo reutilizamos desde el principio
+                front->tail = 0;
+            } else {
+                q->head = front->next;
+                front->next = NULL;
+                queue_node_free(q, front);
+                QUEUE_STATS_SUB(q, bytes, sizeof(Node));
+            }
+        }
+    }
+    QUEUE_STATS_DEQUEUED(q, count);
+    return count;
 }
 
+/**
+ * Vacía la cola, eliminando todos sus elementos.
+ * 
+ * @param q Apuntador a la cola que se desea vaciar.
+ * @details Todos los nodos se devuelven al allocator con `delete_node`. Si la cola vive en una
+ *          arena sus nodos pasan completos a la lista de reciclados, sin recorrerlos, para que
+ *          llenarla y vaciarla muchas veces no siga reservando memoria de la arena.
+ */
 void queue_empty(Queue* q){
-
+    if (q == NULL) {
+        return;
+    }
+    if (q->arena != NULL) {
+#ifdef QUEUE_STATS
+        for (Node *n = q->head; n != NULL; n = n->next) {
+            QUEUE_STATS_DEQUEUED(q, n->tail - n->head);
+            QUEUE_STATS_SUB(q, bytes, sizeof(Node));
+        }
+#endif
+        // La cadena completa pasa a recycled en O(1): tail es su último nodo
+        if (q->head != NULL) {
+            q->tail->next = q->recycled;
+            q->recycled = q->head;
+        }
+        q->head = NULL;
+        q->tail = NULL;
+        return;
+    }
+    while (q->head != NULL) {
+        Node *n = q->head;
+        q->head = n->next;
+        n->next = NULL;
+        QUEUE_STATS_DEQUEUED(q, n->tail - n->head);
+        QUEUE_STATS_SUB(q, bytes, sizeof(Node));
+        delete_node(n);
+    }
+    q->tail = NULL;
 }
 
+/**
+ * Elimina la cola y libera la memoria asociada a ella.
+ * 
+ * @param q Apuntador a la cola que se desea eliminar.
+ * @details Esta función vacía la cola y libera la estructura con `free`. Es responsabilidad
+ *          del llamante asegurarse de que la cola ya no se utiliza después de ser eliminada.
+ *          Una cola creada con `queue_create_in` no se toca: ella y sus nodos pertenecen a la arena.
+ */
 void queue_delete(Queue* q){
+    if (q == NULL || q->arena != NULL) {
+        return;
+    }
+    queue_empty(q);
+    free(q);
+}
 
-}
\ No newline at end of file
+#ifdef QUEUE_STATS
+/**
+ * Devuelve una copia de las estadísticas de uso de la cola.
+ * 
+ * @param q Apuntador a la cola.
+ * @return Los contadores acumulados desde `queue_create`; todos en 0 si `q` es NULL.
+ * @details Solo existe al compilar con -DQUEUE_STATS. La cantidad actual de elementos es
+ *          enqueues - dequeues. Los bytes cuentan los nodos de esta cola, no los bloques
+ *          completos que el allocator de nodos tenga reservados.
+ */
+QueueStats queue_stats(const Queue* q){
+    if (q == NULL) {
+        return (QueueStats){0};
+    }
+    return q->stats;
+}
+#endif
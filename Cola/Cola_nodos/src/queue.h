@@ -2,18 +2,110 @@
 #define __QUEUE_H__
 #include "node.h"
 #include <stdbool.h>
+#include <stddef.h>
 
+// Estadísticas de uso: al compilar con -DQUEUE_STATS cada cola lleva estos contadores y
+// `queue_stats` devuelve una copia. Sin la bandera la estructura no cambia y los macros
+// QUEUE_STATS_* no generan código.
+#ifdef QUEUE_STATS
 typedef struct {
-    Node* head;
-    Node *tail;
+    unsigned long enqueues;    // Elementos insertados
+    unsigned long dequeues;    // Elementos que salieron de la cola (dequeue o vaciado)
+    unsigned long rejected;    // Inserciones descartadas porque no se pudo crear el nodo
+    unsigned long grows;       // Siempre 0: la cola crece de nodo en nodo, ver allocs
+    unsigned long allocs;      // Nodos obtenidos con new_node
+    size_t bytes;              // Bytes que ocupan los nodos de la cola
+    unsigned long high_water;  // Máximo de elementos guardados a la vez
+} QueueStats;
+
+#define QUEUE_STATS_ADD(q, field, n) ((q)->stats.field += (n))
+#define QUEUE_STATS_SUB(q, field, n) ((q)->stats.field -= (n))
+#define QUEUE_STATS_ENQUEUED(q, n) queue_stats_enqueued(&(q)->stats, (n))
+#define QUEUE_STATS_DEQUEUED(q, n) ((q)->stats.dequeues += (n))
+
+// Cuenta n inserciones y actualiza el máximo de elementos (enqueues - dequeues)
+static inline void queue_stats_enqueued(QueueStats* st, unsigned long n) {
+    st->enqueues += n;
+    if (st->enqueues - st->dequeues > st->high_water) {
+        st->high_water = st->enqueues - st->dequeues;
+    }
+}
+#else
+#define QUEUE_STATS_ADD(q, field, n) ((void)0)
+#define QUEUE_STATS_SUB(q, field, n) ((void)0)
+#define QUEUE_STATS_ENQUEUED(q, n) ((void)0)
+#define QUEUE_STATS_DEQUEUED(q, n) ((void)0)
+#endif
+
+typedef struct {
+    Node* head;  // Nodo del que se toman los datos
+    Node *tail;  // Nodo en el que se insertan los datos
+    Arena *arena;    // Arena de la que salen la cola y sus nodos; NULL si usan malloc y node.c
+    Node *recycled;  // Con arena: nodos ya agotados, listos para el siguiente enqueue
+#ifdef QUEUE_STATS
+    QueueStats stats;
+#endif
 } Queue;
 
 Queue* queue_create();
+Queue* queue_create_in(Arena*);
+int queue_enqueue_n(Queue*, const Data*, int);
+int queue_dequeue_n(Queue*, Data*, int);
+void queue_empty(Queue*);
+void queue_delete(Queue*);
+#ifdef QUEUE_STATS
+QueueStats queue_stats(const Queue*);
+#endif
+
+// Obtiene un nodo para la cola con d en su primera posición: de su arena, reutilizando primero
+// los nodos ya agotados, o del allocator de bloques de node.c si la cola no tiene arena
+static inline Node* queue_node_new(Queue* q, Data d){
+    if (q->arena == NULL) {
+        return new_node(d);
+    }
+    Node *n = q->recycled;
+    if (n == NULL) {
+        return new_node_in(q->arena, d);
+    }
+    q->recycled = n->next;
+    n->data[0] = d;
+    n->head = 0;
+    n->tail = 1;
+    n->next = NULL;
+    return n;
+}
+
+// Devuelve un nodo agotado (con next en NULL) a su origen
+static inline void queue_node_free(Queue* q, Node* n){
+    if (q->arena == NULL) {
+        delete_node(n);
+        return;
+    }
+    n->next = q->recycled;
+    q->recycled = n;
+}
+
+// Modo sin verificaciones: con -DQUEUE_UNCHECKED las comprobaciones defensivas de apuntadores
+// NULL en las operaciones frecuentes se vuelven assert, que solo existen en compilaciones de
+// depuración; con -DNDEBUG además desaparecen del código. Las verificaciones de cola vacía
+// se conservan, porque forman parte del resultado de las funciones.
+#ifdef QUEUE_UNCHECKED
+#include <assert.h>
+#define QUEUE_INVALID(p) (assert((p) != NULL), false)
+#else
+#define QUEUE_INVALID(p) ((p) == NULL)
+#endif
+
+// Operaciones frecuentes: con -DQUEUE_HEADER_ONLY se definen como static inline en queue_inline.h
+#ifdef QUEUE_HEADER_ONLY
+#define QUEUE_INLINE static inline
+#include "queue_inline.h"
+#else
 void queue_enqueue(Queue* , Data);
-int queue_dequeue(Queue*);
+Data queue_dequeue(Queue*);
+bool queue_try_dequeue(Queue*, Data*);
 bool queue_is_empty(Queue*);
 Data queue_front(Queue*);
-void queue_empty(Queue*);
-void queue_delete(Queue*);
+#endif
 
 #endif // __QUEUE_H__
\ No newline at end of file
@@ -0,0 +1,116 @@
+#ifndef __QUEUE_INLINE_H__
+#define __QUEUE_INLINE_H__
+#include <stddef.h>
+
+// Operaciones frecuentes de la cola. Este archivo no se incluye directamente:
+// queue.h lo incluye con QUEUE_INLINE = static inline cuando se compila con -DQUEUE_HEADER_ONLY,
+// para que el compilador pueda integrarlas en el código que las llama, y queue.c lo incluye
+// con QUEUE_INLINE vacío para generar las versiones normales.
+
+/**
+ * Verifica si la cola está vacía.
+ * 
+ * @param q Apuntador a la cola que se desea verificar.
+ * @return `true` si la cola está vacía o el puntero `q` es NULL, `false` si no lo está.
+ */
+QUEUE_INLINE bool queue_is_empty(Queue* q){
+    return QUEUE_INVALID(q) || q->head == NULL || q->head->head == q->head->tail;
+}
+
+/**
+ * Inserta un elemento al final de la cola.
+ * 
+ * @param q Apuntador a la cola donde se insertará el elemento.
+ * @param d Dato que se insertará en la cola.
+ * @details El dato se escribe en el siguiente espacio libre del nodo tail. Solo cuando ese nodo
+ *          está lleno se obtiene uno nuevo con `new_node`, es decir, una vez cada NODE_CAPACITY
+ *          elementos. Si el puntero `q` es NULL o no se pudo crear el nodo, la función no realiza
+ *          ninguna operación.
+ */
+QUEUE_INLINE void queue_enqueue(Queue* q, Data d){
+    if (QUEUE_INVALID(q)) {
+        return;
+    }
+    if (q->tail != NULL && q->tail->tail < NODE_CAPACITY) {
+        q->tail->data[q->tail->tail++] = d;  // Hay espacio en el último nodo
+        QUEUE_STATS_ENQUEUED(q, 1);
+        return;
+    }
+    Node *n = queue_node_new(q, d);
+    if (n == NULL) {
+        QUEUE_STATS_ADD(q, rejected, 1);
+        return;
+    }
+    if (q->tail == NULL) {
+        q->head = n;  // La cola estaba vacía, el nodo es también el frente
+    } else {
+        q->tail->next = n;
+    }
+    q->tail = n;
+    QUEUE_STATS_ADD(q, allocs, 1);
+    QUEUE_STATS_ADD(q, bytes, sizeof(Node));
+    QUEUE_STATS_ENQUEUED(q, 1);
+}
+
+/**
+ * Intenta extraer el elemento al frente de la cola.
+ * 
+ * @param q Apuntador a la cola de la cual se extraerá el elemento.
+ * @param out Donde se guarda el dato extraído.
+ * @return `true` si se extrajo un dato, `false` si la cola está vacía (out no cambia).
+ * @details A diferencia de `queue_dequeue`, no hay un valor de error que se confunda con un
+ *          dato, así que no hace falta llamar antes a `queue_is_empty`: la cola se revisa una
+ *          sola vez. El nodo head se libera o reinicia igual que en `queue_dequeue`.
+ */
+QUEUE_INLINE bool queue_try_dequeue(Queue* q, Data* out){
+    if (queue_is_empty(q) || QUEUE_INVALID(out)) {
+        return false;
+    }
+    Node *front = q->head;
+    *out = front->data[front->head++];
+    if (front->head == front->tail) {
+        if (front == q->tail) {
+            front->head = 0;  // Único nodo: lo reutilizamos desde el principio
+            front->tail = 0;
+        } else {
+            q->head = front->next;
+            front->next = NULL;  // delete_node solo acepta nodos sin siguiente
+            queue_node_free(q, front);
+            QUEUE_STATS_SUB(q, bytes, sizeof(Node));
+        }
+    }
+    QUEUE_STATS_DEQUEUED(q, 1);
+    return true;
+}
+
+/**
+ * Elimina y devuelve el elemento al frente de la cola.
+ * 
+ * @param q Apuntador a la cola de la cual se eliminará el elemento.
+ * @return El dato que estaba al frente de la cola. Si la cola está vacía o el puntero
+ *         `q` es NULL, devuelve -1.
+ * @details El dato se lee del nodo head. Cuando ese nodo se agota se desenlaza y se devuelve al
+ *          allocator con `delete_node` (o a la cola, si vive en una arena); si era el único nodo
+ *          se conserva y solo se reinician sus posiciones, para no crear y destruir nodos cuando
+ *          la cola oscila cerca de vacía.
+ */
+QUEUE_INLINE Data queue_dequeue(Queue* q){
+    Data d = -1;
+    queue_try_dequeue(q, &d);
+    return d;
+}
+
+/**
+ * Obtiene el elemento al frente de la cola sin eliminarlo.
+ * 
+ * @param q Apuntador a la cola de la cual se desea obtener el elemento.
+ * @return El dato que está al frente de la cola. Si la cola está vacía, devuelve -1.
+ */
+QUEUE_INLINE Data queue_front(Queue* q){
+    if (queue_is_empty(q)) {
+        return -1;
+    }
+    return q->head->data[q->head->head];
+}
+
+#endif // __QUEUE_INLINE_H__
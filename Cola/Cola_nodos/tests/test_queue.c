@@ -29,6 +29,172 @@ START_TEST(test_queue_enqueue_dequeue) {
 }
 END_TEST
 
+START_TEST(test_queue_node_reuse) {
+    Queue *queue = queue_create();
+
+    // Un nodo liberado por dequeue se reutiliza en el siguiente enqueue
+    queue_enqueue(queue, 10);
+    Node *first = queue->head;
+    ck_assert_int_eq(queue_dequeue(queue), 10);
+    queue_enqueue(queue, 20);
+    ck_assert_ptr_eq(queue->head, first);
+    ck_assert_int_eq(queue_front(queue), 20);
+    queue_delete(queue);
+}
+END_TEST
+
+START_TEST(test_queue_across_nodes) {
+    Queue *queue = queue_create();
+
+    // Suficientes elementos para ocupar varios nodos
+    for (int i = 0; i < 10 * NODE_CAPACITY + 3; i++) {
+        queue_enqueue(queue, i);
+    }
+    ck_assert_ptr_ne(queue->head, queue->tail);
+    for (int i = 0; i < 10 * NODE_CAPACITY + 3; i++) {
+        ck_assert_int_eq(queue_front(queue), i);
+        ck_assert_int_eq(queue_dequeue(queue), i);
+    }
+    ck_assert(queue_is_empty(queue));
+    ck_assert_ptr_eq(queue->head, queue->tail);
+    queue_delete(queue);
+}
+END_TEST
+
+#ifdef QUEUE_STATS
+START_TEST(test_queue_stats) {
+    Queue *q = queue_create();
+    Data in[10] = {0};
+
+    for (int i = 0; i < 2 * NODE_CAPACITY + 30; i++) {
+        queue_enqueue(q, i);
+    }
+    for (int i = 0; i < NODE_CAPACITY + 10; i++) {
+        queue_dequeue(q);
+    }
+    queue_enqueue_n(q, in, 10);
+
+    QueueStats st = queue_stats(q);
+    ck_assert_uint_eq(st.enqueues, 2 * NODE_CAPACITY + 40);
+    ck_assert_uint_eq(st.dequeues, NODE_CAPACITY + 10);
+    ck_assert_uint_eq(st.high_water, 2 * NODE_CAPACITY + 30);
+    ck_assert_uint_eq(st.allocs, 3);
+    ck_assert_uint_eq(st.bytes, 2 * sizeof(Node));  // El primer nodo ya se agotó
+    ck_assert_uint_eq(st.rejected, 0);
+
+    queue_empty(q);
+    st = queue_stats(q);
+    ck_assert_uint_eq(st.enqueues - st.dequeues, 0);
+    ck_assert_uint_eq(st.bytes, 0);
+    queue_delete(q);
+}
+END_TEST
+#endif
+
+START_TEST(test_queue_enqueue_dequeue_n) {
+    Queue *queue = queue_create();
+    Data in[5 * NODE_CAPACITY];
+    Data out[5 * NODE_CAPACITY];
+
+    for (int i = 0; i < 5 * NODE_CAPACITY; i++) {
+        in[i] = i;
+    }
+    queue_enqueue(queue, -1);
+    ck_assert_int_eq(queue_enqueue_n(queue, in, 5 * NODE_CAPACITY), 5 * NODE_CAPACITY);
+    ck_assert_int_eq(queue_dequeue(queue), -1);
+    ck_assert_int_eq(queue_dequeue_n(queue, out, 3), 3);
+    ck_assert_int_eq(out[2], 2);
+    ck_assert_int_eq(queue_dequeue_n(queue, out, 5 * NODE_CAPACITY), 5 * NODE_CAPACITY - 3);
+    for (int i = 0; i < 5 * NODE_CAPACITY - 3; i++) {
+        ck_assert_int_eq(out[i], i + 3);
+    }
+    ck_assert(queue_is_empty(queue));
+    queue_delete(queue);
+}
+END_TEST
+
+START_TEST(test_queue_arena) {
+    Arena arena;
+    arena_init(&arena);
+    Queue *queues[8];
+    int n = 5 * NODE_CAPACITY;
+
+    // Varias colas en la misma arena; ninguna se elimina por separado
+    for (int k = 0; k < 8; k++) {
+        queues[k] = queue_create_in(&arena);
+        ck_assert_ptr_nonnull(queues[k]);
+        for (int i = 0; i < n; i++) {
+            queue_enqueue(queues[k], k * n + i);
+        }
+    }
+    for (int k = 0; k < 8; k++) {
+        for (int i = 0; i < n / 2; i++) {
+            ck_assert_int_eq(queue_dequeue(queues[k]), k * n + i);
+        }
+    }
+
+    // Los nodos agotados se reutilizan en la misma cola
+    Node *spent = queues[0]->recycled;
+    ck_assert_ptr_nonnull(spent);
+    for (int i = 0; i < NODE_CAPACITY; i++) {
+        queue_enqueue(queues[0], i);
+    }
+    ck_assert_ptr_eq(queues[0]->tail, spent);
+
+    Data in[3] = { 1, 2, 3 };
+    Data out[3];
+    queue_empty(queues[1]);
+    ck_assert(queue_is_empty(queues[1]));
+    ck_assert_int_eq(queue_enqueue_n(queues[1], in, 3), 3);
+    ck_assert_int_eq(queue_dequeue_n(queues[1], out, 3), 3);
+    ck_assert_int_eq(out[2], 3);
+
+    queue_delete(queues[2]);  // Sin efecto: la cola pertenece a la arena
+    ck_assert_int_eq(queue_front(queues[2]), 2 * n + n / 2);
+
+    // Llenar y vaciar muchas veces reutiliza los mismos nodos: la arena no crece
+    queue_empty(queues[3]);
+    char *cur = arena.cur;
+    ArenaBlock *blocks = arena.blocks;
+    for (int round = 0; round < 10; round++) {
+        for (int i = 0; i < n; i++) {
+            queue_enqueue(queues[3], i);
+        }
+        ck_assert_int_eq(queue_dequeue(queues[3]), 0);
+        queue_empty(queues[3]);
+        ck_assert(queue_is_empty(queues[3]));
+    }
+    ck_assert_ptr_eq(arena.cur, cur);
+    ck_assert_ptr_eq(arena.blocks, blocks);
+
+    arena_release(&arena);
+    ck_assert_ptr_null(arena.blocks);
+}
+END_TEST
+
+START_TEST(test_queue_try_dequeue) {
+    Queue *queue = queue_create();
+    Data d = 99;
+
+    ck_assert(!queue_try_dequeue(queue, &d));
+    ck_assert_int_eq(d, 99);  // Sin datos, out no cambia
+
+    // -1 es un dato como cualquier otro: try_dequeue lo distingue de una cola vacía
+    queue_enqueue(queue, -1);
+    queue_enqueue(queue, 5);
+    queue_enqueue(queue, 6);
+    ck_assert(queue_try_dequeue(queue, &d));
+    ck_assert_int_eq(d, -1);
+    ck_assert(queue_try_dequeue(queue, &d));
+    ck_assert_int_eq(d, 5);
+    ck_assert(queue_try_dequeue(queue, &d));
+    ck_assert_int_eq(d, 6);
+    ck_assert(!queue_try_dequeue(queue, &d));
+    ck_assert(queue_is_empty(queue));
+    queue_delete(queue);
+}
+END_TEST
+
 Suite* queue_suite(void) {
     Suite* s;
     TCase* tc_core;
@@ -38,6 +204,14 @@ Suite* queue_suite(void) {
     tc_core = tcase_create("Core");
     tcase_add_test(tc_core, test_queue_init);
     tcase_add_test(tc_core, test_queue_enqueue_dequeue);
+    tcase_add_test(tc_core, test_queue_node_reuse);
+    tcase_add_test(tc_core, test_queue_across_nodes);
+#ifdef QUEUE_STATS
+    tcase_add_test(tc_core, test_queue_stats);
+#endif
+    tcase_add_test(tc_core, test_queue_enqueue_dequeue_n);
+    tcase_add_test(tc_core, test_queue_arena);
+    tcase_add_test(tc_core, test_queue_try_dequeue);
     suite_add_tcase(s, tc_core);
 
     return s;
@@ -0,0 +1,83 @@
+#define _POSIX_C_SOURCE 200809L  // clock_gettime
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../src/pqueue.h"
+
+// Rendimiento del montículo con PQUEUE_ARITY hijos por nodo. El Makefile lo compila dos veces,
+// bench_heap2 (binario) y bench_heap4, para comparar las dos aridades con los mismos datos.
+// Para contar fallos de caché: perf stat -e cache-misses ./bench_heap4 10000000
+// Uso: ./bench_heapD [n] [--sin-encabezado]   (por defecto n = 10^7)
+
+static volatile Data sink;  // Evita que el compilador descarte las extracciones
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void report(const char* op, int n, double seconds) {
+    printf("%d,%d,%s,%.3f,%.1f\n", PQUEUE_ARITY, n, op, seconds, seconds * 1e9 / n);
+}
+
+int main(int argc, char** argv) {
+    int n = argc > 1 ? atoi(argv[1]) : 10000000;
+    if (n <= 0) {
+        fprintf(stderr, "%s: n debe ser positivo\n", argv[0]);
+        return 1;
+    }
+    Data* in = (Data*)malloc((size_t)n * sizeof(Data));
+    if (in == NULL) {
+        fprintf(stderr, "%s: no hay memoria para %d datos\n", argv[0], n);
+        return 1;
+    }
+    uint32_t rng = 2463534242u;
+    for (int i = 0; i < n; i++) {
+        rng ^= rng << 13;
+        rng ^= rng >> 17;
+        rng ^= rng << 5;
+        in[i] = (Data)(rng >> 1);
+    }
+
+    if (argc <= 2) {
+        printf("aridad,n,operacion,segundos,ns_por_op\n");
+    }
+
+    double start = now();
+    PQueue q = pqueue_heapify(in, n);
+    report("heapify", n, now() - start);
+    pqueue_delete(&q);
+
+    q = pqueue_create(16);
+    start = now();
+    for (int i = 0; i < n; i++) {
+        pqueue_push(&q, in[i]);
+    }
+    report("push", n, now() - start);
+
+    Data check = 0;
+    start = now();
+    for (int i = 0; i < n; i++) {
+        check ^= pqueue_pop(&q);
+    }
+    report("pop", n, now() - start);
+
+    // Carga de planificador: la cola se mantiene con n / 2 elementos y cada paso extrae el
+    // menor e inserta uno nuevo
+    for (int i = 0; i < n / 2; i++) {
+        pqueue_push(&q, in[i]);
+    }
+    start = now();
+    for (int i = n / 2; i < n; i++) {
+        check ^= pqueue_pop(&q);
+        pqueue_push(&q, in[i]);
+    }
+    report("pop_push", n - n / 2, now() - start);
+
+    sink = check;
+    pqueue_delete(&q);
+    free(in);
+    return 0;
+}
@@ -0,0 +1,262 @@
+#include "pqueue.h"
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * Reserva (o agranda) los arreglos de la cola para len elementos.
+ *
+ * @param q Referencia a la cola; sus datos actuales se conservan.
+ * @param len Nueva capacidad.
+ * @return `true` si se pudo reservar la memoria, `false` si no (la cola no cambia).
+ * @details El montículo se reserva alineado a PQUEUE_CACHE_LINE y se desplaza PQUEUE_ARITY - 1
+ *          elementos, de modo que cada grupo de hijos heap[d*i + 1 .. d*i + d] comienza en una
+ *          dirección múltiplo de su tamaño y nunca cruza una línea de caché (cuando el grupo
+ *          mide a lo más una línea). Como aligned_alloc no tiene equivalente de realloc,
+ *          crecer copia los datos a un bloque nuevo.
+ */
+static bool pqueue_reserve(PQueue* q, int len) {
+    size_t bytes = (len + PQUEUE_ARITY - 1) * sizeof(PQueueEntry);
+    bytes = (bytes + PQUEUE_CACHE_LINE - 1) / PQUEUE_CACHE_LINE * PQUEUE_CACHE_LINE;
+    void *block = aligned_alloc(PQUEUE_CACHE_LINE, bytes);
+    int *pos = (int*)realloc(q->pos, len * sizeof(int));
+    if (pos != NULL) {
+        q->pos = pos;
+    }
+    int *free_handles = (int*)realloc(q->free_handles, len * sizeof(int));
+    if (free_handles != NULL) {
+        q->free_handles = free_handles;
+    }
+    if (block == NULL || pos == NULL || free_handles == NULL) {
+        free(block);
+        return false;
+    }
+
+    PQueueEntry *heap = (PQueueEntry*)block + (PQUEUE_ARITY - 1);
+    if (q->size > 0) {
+        memcpy(heap, q->heap, q->size * sizeof(PQueueEntry));
+    }
+    free(q->block);
+    q->block = block;
+    q->heap = heap;
+    q->len = len;
+    return true;
+}
+
+/**
+ * Crea una nueva cola de prioridad vacía.
+ *
+ * @param len Cantidad de elementos que se pueden guardar antes de crecer.
+ * @return Una nueva cola vacía. Si la creación falla, heap es NULL y len es 0.
+ */
+PQueue pqueue_create(int len) {
+    PQueue q;
+    memset(&q, 0, sizeof(PQueue));
+    if (len < 1) {
+        len = 1;
+    }
+    if (!pqueue_reserve(&q, len)) {
+        pqueue_delete(&q);
+    }
+    return q;
+}
+
+/**
+ * Coloca la entrada e en la posición i del montículo y actualiza pos.
+ */
+static inline void pqueue_place(PQueue* q, int i, PQueueEntry e) {
+    q->heap[i] = e;
+    q->pos[e.handle] = i;
+}
+
+/**
+ * Sube la entrada de la posición i mientras sea menor que su padre.
+ */
+static void pqueue_sift_up(PQueue* q, int i) {
+    PQueueEntry e = q->heap[i];
+    while (i > 0) {
+        int parent = (i - 1) / PQUEUE_ARITY;
+        if (q->heap[parent].priority <= e.priority) {
+            break;
+        }
+        pqueue_place(q, i, q->heap[parent]);
+        i = parent;
+    }
+    pqueue_place(q, i, e);
+}
+
+/**
+ * Baja la entrada de la posición i mientras alguno de sus hijos sea menor.
+ *
+ * @details Los PQUEUE_ARITY hijos son contiguos y están en la misma línea de caché, así que
+ *          elegir el menor cuesta una sola lectura de memoria por nivel; con más hijos el
+ *          montículo tiene menos niveles que uno binario.
+ */
+static void pqueue_sift_down(PQueue* q, int i) {
+    PQueueEntry e = q->heap[i];
+    for (;;) {
+        int first = PQUEUE_ARITY * i + 1;
+        if (first >= q->size) {
+            break;
+        }
+        int last = first + PQUEUE_ARITY < q->size ? first + PQUEUE_ARITY : q->size;
+        int min = first;
+        for (int c = first + 1; c < last; c++) {
+            // Selección sin saltos (cmov): el resultado de comparar hijos es impredecible
+            min = q->heap[c].priority < q->heap[min].priority ? c : min;
+        }
+        if (q->heap[min].priority >= e.priority) {
+            break;
+        }
+        pqueue_place(q, i, q->heap[min]);
+        i = min;
+    }
+    pqueue_place(q, i, e);
+}
+
+/**
+ * Construye una cola de prioridad con los n datos de un arreglo, en tiempo O(n).
+ *
+ * @param in Arreglo con los datos.
+ * @param n Cantidad de datos en `in`.
+ * @return La cola con los datos. El elemento in[i] recibe el identificador i. Si la creación
+ *         falla, heap es NULL.
+ * @details Se copian los datos tal cual y se aplica sift-down desde el último nodo con hijos
+ *          hasta la raíz (algoritmo de Floyd), en lugar de n inserciones de costo O(log n).
+ */
+PQueue pqueue_heapify(const Data* in, int n) {
+    PQueue q = pqueue_create(n);
+    if (q.heap == NULL || in == NULL || n <= 0) {
+        return q;
+    }
+    for (int i = 0; i < n; i++) {
+        pqueue_place(&q, i, (PQueueEntry){ in[i], i });
+    }
+    q.size = n;
+    q.n_handles = n;
+    for (int i = (n - 2) / PQUEUE_ARITY; i >= 0; i--) {
+        pqueue_sift_down(&q, i);
+    }
+    return q;
+}
+
+/**
+ * Inserta un dato en la cola.
+ *
+ * @param q Referencia a la cola.
+ * @param d Dato (prioridad) que se insertará.
+ * @return El identificador del elemento, para `pqueue_decrease_key`; -1 si no hubo memoria.
+ * @details Si la cola está llena su capacidad se duplica.
+ */
+PQueueHandle pqueue_push(PQueue* q, Data d) {
+    if (q == NULL || q->heap == NULL) {
+        return -1;
+    }
+    if (q->size == q->len && !pqueue_reserve(q, q->len * 2)) {
+        return -1;
+    }
+    PQueueHandle h = q->n_free > 0 ? q->free_handles[--q->n_free] : q->n_handles++;
+    q->heap[q->size] = (PQueueEntry){ d, h };
+    q->pos[h] = q->size;
+    q->size++;
+    pqueue_sift_up(q, q->size - 1);
+    return h;
+}
+
+/**
+ * Elimina y devuelve el dato menor de la cola.
+ *
+ * @param q Referencia a la cola.
+ * @return El dato menor, o -1 si la cola está vacía. Su identificador queda libre.
+ */
+Data pqueue_pop(PQueue* q) {
+    if (pqueue_is_empty(q)) {
+        return -1;
+    }
+    PQueueEntry top = q->heap[0];
+    q->pos[top.handle] = -1;
+    q->free_handles[q->n_free++] = top.handle;
+
+    q->size--;
+    if (q->size > 0) {
+        q->heap[0] = q->heap[q->size];
+        pqueue_sift_down(q, 0);
+    }
+    return top.priority;
+}
+
+/**
+ * Devuelve el dato menor sin eliminarlo.
+ *
+ * @param q Referencia a la cola.
+ * @return El dato menor, o -1 si la cola está vacía.
+ */
+Data pqueue_top(PQueue* q) {
+    if (pqueue_is_empty(q)) {
+        return -1;
+    }
+    return q->heap[0].priority;
+}
+
+/**
+ * Reduce la prioridad de un elemento que está en la cola.
+ *
+ * @param q Referencia a la cola.
+ * @param h Identificador devuelto por `pqueue_push` o asignado por `pqueue_heapify`.
+ * @param d Nueva prioridad, menor o igual que la actual.
+ * @return `true` si se actualizó, `false` si h no está en la cola o d es mayor que la actual.
+ */
+bool pqueue_decrease_key(PQueue* q, PQueueHandle h, Data d) {
+    if (q == NULL || q->heap == NULL || h < 0 || h >= q->n_handles || q->pos[h] < 0) {
+        return false;
+    }
+    int i = q->pos[h];
+    if (d > q->heap[i].priority) {
+        return false;
+    }
+    q->heap[i].priority = d;
+    pqueue_sift_up(q, i);
+    return true;
+}
+
+/**
+ * Verifica si la cola está vacía.
+ *
+ * @return `true` si la cola está vacía o es inválida.
+ */
+bool pqueue_is_empty(PQueue* q) {
+    return q == NULL || q->heap == NULL || q->size == 0;
+}
+
+/**
+ * Devuelve la cantidad de elementos en la cola.
+ */
+int pqueue_size(PQueue* q) {
+    return q == NULL ? 0 : q->size;
+}
+
+/**
+ * Vacía la cola; la capacidad reservada se conserva y todos los identificadores quedan libres.
+ */
+void pqueue_empty(PQueue* q) {
+    if (q == NULL) {
+        return;
+    }
+    q->size = 0;
+    q->n_free = 0;
+    q->n_handles = 0;
+}
+
+/**
+ * Elimina la cola y libera la memoria asociada a ella.
+ *
+ * @param q Referencia a la cola que se desea eliminar.
+ */
+void pqueue_delete(PQueue* q) {
+    if (q == NULL) {
+        return;
+    }
+    free(q->block);
+    free(q->pos);
+    free(q->free_handles);
+    memset(q, 0, sizeof(PQueue));
+}
@@ -0,0 +1,51 @@
+#ifndef __PQUEUE_H__
+#define __PQUEUE_H__
+
+#include <stdbool.h>
+
+typedef int Data;
+
+// Cantidad de hijos de cada nodo del montículo. Con 4 hijos de 8 bytes, los hijos de un nodo
+// ocupan 32 bytes alineados y un sift-down lee una sola línea de caché por nivel.
+// Puede cambiarse al compilar, por ejemplo con -DPQUEUE_ARITY=2 para un montículo binario.
+#ifndef PQUEUE_ARITY
+#define PQUEUE_ARITY 4
+#endif
+
+#define PQUEUE_CACHE_LINE 64
+
+// Identificador estable de un elemento mientras está en la cola, para `pqueue_decrease_key`.
+// Los identificadores de elementos ya extraídos se reutilizan.
+typedef int PQueueHandle;
+
+// Elemento del montículo: su prioridad (el dato) y el identificador que lo ubica en pos
+typedef struct {
+    Data priority;
+    PQueueHandle handle;
+} PQueueEntry;
+
+// Cola de prioridad mínima sobre un montículo d-ario contiguo: pqueue_pop devuelve el dato
+// menor. Los hijos del nodo i están en heap[PQUEUE_ARITY * i + 1 .. PQUEUE_ARITY * i + PQUEUE_ARITY].
+typedef struct {
+    PQueueEntry *heap;  // Montículo; heap[1] empieza en un múltiplo del tamaño del grupo de hijos
+    void *block;        // Memoria reservada (alineada) que contiene heap
+    int size;           // Cantidad de elementos
+    int len;            // Capacidad de heap, pos y free_handles
+    int *pos;           // pos[h] = índice en heap del elemento con identificador h, -1 si está libre
+    int *free_handles;  // Pila de identificadores libres
+    int n_free;
+    int n_handles;      // Identificadores entregados alguna vez (0 .. n_handles - 1)
+} PQueue;
+
+PQueue pqueue_create(int len);
+PQueue pqueue_heapify(const Data*, int);
+PQueueHandle pqueue_push(PQueue*, Data);
+Data pqueue_pop(PQueue*);
+Data pqueue_top(PQueue*);
+bool pqueue_decrease_key(PQueue*, PQueueHandle, Data);
+bool pqueue_is_empty(PQueue*);
+int pqueue_size(PQueue*);
+void pqueue_empty(PQueue*);
+void pqueue_delete(PQueue*);
+
+#endif // __PQUEUE_H__
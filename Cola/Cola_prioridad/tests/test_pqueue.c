@@ -0,0 +1,111 @@
+#include <check.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "../src/pqueue.h"
+
+START_TEST(test_pqueue_init) {
+    PQueue q = pqueue_create(4);
+    ck_assert_ptr_nonnull(q.heap);
+    ck_assert(pqueue_is_empty(&q));
+    ck_assert_int_eq(pqueue_pop(&q), -1);
+    pqueue_delete(&q);
+    ck_assert_ptr_null(q.heap);
+}
+END_TEST
+
+START_TEST(test_pqueue_push_pop) {
+    PQueue q = pqueue_create(1);
+    Data values[] = { 42, 7, 19, 3, 88, 7, 0, 64, 25, 11 };
+    Data sorted[] = { 0, 3, 7, 7, 11, 19, 25, 42, 64, 88 };
+
+    // La cola crece más allá de su capacidad inicial y devuelve los datos de menor a mayor
+    for (int i = 0; i < 10; i++) {
+        ck_assert_int_ge(pqueue_push(&q, values[i]), 0);
+    }
+    ck_assert_int_eq(pqueue_size(&q), 10);
+    ck_assert_int_eq(pqueue_top(&q), 0);
+    for (int i = 0; i < 10; i++) {
+        ck_assert_int_eq(pqueue_pop(&q), sorted[i]);
+    }
+    ck_assert(pqueue_is_empty(&q));
+    pqueue_delete(&q);
+}
+END_TEST
+
+START_TEST(test_pqueue_heapify) {
+    int n = 10000;
+    Data* in = (Data*)malloc(n * sizeof(Data));
+    uint32_t rng = 12345;
+    for (int i = 0; i < n; i++) {
+        rng = rng * 1103515245u + 12345u;
+        in[i] = (Data)(rng >> 8) % 1000;
+    }
+
+    PQueue q = pqueue_heapify(in, n);
+    ck_assert_int_eq(pqueue_size(&q), n);
+
+    // Los grupos de hijos empiezan alineados a su tamaño
+    ck_assert_uint_eq((uintptr_t)&q.heap[1] % (PQUEUE_ARITY * sizeof(PQueueEntry)), 0);
+
+    Data prev = pqueue_pop(&q);
+    for (int i = 1; i < n; i++) {
+        Data d = pqueue_pop(&q);
+        ck_assert_int_le(prev, d);
+        prev = d;
+    }
+    pqueue_delete(&q);
+    free(in);
+}
+END_TEST
+
+START_TEST(test_pqueue_decrease_key) {
+    PQueue q = pqueue_create(8);
+    PQueueHandle handles[20];
+    for (int i = 0; i < 20; i++) {
+        handles[i] = pqueue_push(&q, 100 + i);
+    }
+
+    ck_assert(pqueue_decrease_key(&q, handles[15], 5));
+    ck_assert(!pqueue_decrease_key(&q, handles[3], 500));  // No se puede aumentar
+    ck_assert(pqueue_decrease_key(&q, handles[9], 50));
+    ck_assert_int_eq(pqueue_pop(&q), 5);
+    ck_assert_int_eq(pqueue_pop(&q), 50);
+    ck_assert_int_eq(pqueue_pop(&q), 100);
+
+    // Los identificadores de elementos extraídos ya no son válidos
+    ck_assert(!pqueue_decrease_key(&q, handles[15], 1));
+    ck_assert(!pqueue_decrease_key(&q, -1, 1));
+    pqueue_delete(&q);
+}
+END_TEST
+
+Suite* pqueue_suite(void) {
+    Suite* s;
+    TCase* tc_core;
+
+    s = suite_create("PQueue");
+
+    tc_core = tcase_create("Core");
+    tcase_add_test(tc_core, test_pqueue_init);
+    tcase_add_test(tc_core, test_pqueue_push_pop);
+    tcase_add_test(tc_core, test_pqueue_heapify);
+    tcase_add_test(tc_core, test_pqueue_decrease_key);
+    suite_add_tcase(s, tc_core);
+
+    return s;
+}
+
+int main(void) {
+    int number_failed;
+    Suite* s;
+    SRunner* sr;
+
+    s = pqueue_suite();
+    sr = srunner_create(s);
+
+    srunner_run_all(sr, CK_NORMAL);
+    number_failed = srunner_ntests_failed(sr);
+    srunner_free(sr);
+
+    return (number_failed == 0) ? 0 : 1;
+}
@@ -1,5 +1,14 @@
+#define _POSIX_C_SOURCE 200112L  // fileno
 #include "stack.h"
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+
+// Versiones normales (no inline) de las operaciones frecuentes
+#ifndef STACK_HEADER_ONLY
+#define STACK_INLINE
+#include "stack_inline.h"
+#endif
 
 /**
  * Crea una nueva pila vacía y la devuelve.
@@ -10,68 +19,57 @@
 Stack stack_create() {
     Stack s;
     s.top = -1;  // Inicializa el top de la pila a -1 para indicar que está vacía
+#ifdef STACK_STATS
+    s.stats = (StackStats){0};
+    s.stats.bytes = sizeof(s.data);
+#endif
     return s;
 }
 
 /**
- * Inserta un elemento en la parte superior de la pila.
- * 
- * @param s Referencia a la pila donde se insertará el elemento.
- * @param d Dato que se insertará en la pila.
- * @details Esta función añade el dato `d` en la parte superior de la pila. Si la pila está llena, 
- *          la función no realiza ninguna operación.
- */
-void stack_push(Stack* s, Data d) {
-    if (s == NULL) {
-        return;  // Si el puntero a la pila es NULL, no hacemos nada
-    }
-    
-    // Verificamos si la pila está llena, si lo está no podemos insertar más elementos
-    if (s->top == MAX_SIZE - 1) {
-        return;
-    }
-
-    // Incrementamos el top y añadimos el dato en la nueva posición
-    s->top++;
-    s->data[s->top] = d;
-}
-
-/**
- * Elimina y devuelve el elemento en la parte superior de la pila.
+ * Inserta varios elementos en la parte superior de la pila con una sola copia.
  * 
- * @param s Referencia a la pila de la cual se eliminará el elemento.
- * @return El dato que estaba en la parte superior de la pila. Si la pila está vacía 
- *         devuelve un valor que indica error (por ejemplo, -1 o un valor predeterminado).
- * @details Esta función elimina el elemento en la parte superior de la pila y lo devuelve.
- *          Si la pila está vacía, no se realiza ninguna operación y se devuelve un valor de error.
+ * @param s Referencia a la pila donde se insertarán los elementos.
+ * @param in Arreglo con los datos a insertar; in[n - 1] queda en el top.
+ * @param n Cantidad de datos en `in`.
+ * @return Cantidad de datos insertados, menor que n si la pila se llenó.
+ * @details Equivale a llamar `stack_push` con in[0], in[1], ..., pero copia todos los datos
+ *          que caben con un solo `memcpy`.
  */
-Data stack_pop(Stack* s) {
-    Data error_value;  // Valor de error, puede ser un valor predeterminado
-    if (s == NULL || stack_is_empty(s)) {
-        return error_value;  // Si la pila es NULL o está vacía, devolvemos un valor de error
+int stack_push_n(Stack* s, const Data* in, int n) {
+    if (s == NULL || in == NULL || n <= 0) {
+        return 0;
     }
 
-    // Extraemos el dato en la parte superior de la pila
-    Data top = s->data[s->top];
-    s->top--;  // Reducimos el top de la pila
-
-    return top;
+    int free_slots = MAX_SIZE - 1 - s->top;
+    int count = n < free_slots ? n : free_slots;
+    memcpy(&s->data[s->top + 1], in, count * sizeof(Data));
+    s->top += count;
+    STACK_STATS_PUSHED(s, count);
+    STACK_STATS_ADD(s, rejected, n - count);
+    return count;
 }
 
 /**
- * Verifica si la pila está vacía.
+ * Extrae varios elementos de la parte superior de la pila con una sola copia.
  * 
- * @param s Referencia a la pila que se desea verificar.
- * @return 1 si la pila está vacía, 0 si no lo está. Si el puntero `s` es NULL, devuelve -1.
- * @details Esta función comprueba si la pila no contiene elementos. Es útil para evitar operaciones
- *          como `stack_pop` en una pila vacía.
+ * @param s Referencia a la pila de la cual se extraerán los elementos.
+ * @param out Arreglo donde se guardan los datos extraídos.
+ * @param n Cantidad máxima de datos a extraer.
+ * @return Cantidad de datos extraídos, menor que n si la pila se vació.
+ * @details Los datos quedan en `out` en el orden en que se insertaron: out[count - 1] es el que
+ *          estaba en el top. Así `stack_pop_n` deshace exactamente un `stack_push_n`.
  */
-int stack_is_empty(Stack* s) {
-    if (s == NULL) {
-        return -1;  // Si la pila es NULL, devolvemos -1
+int stack_pop_n(Stack* s, Data* out, int n) {
+    if (s == NULL || out == NULL || n <= 0) {
+        return 0;
     }
 
-    return s->top == -1 ? 1 : 0;  // Si top es -1, la pila está vacía
+    int count = n < s->top + 1 ? n : s->top + 1;
+    s->top -= count;
+    memcpy(out, &s->data[s->top + 1], count * sizeof(Data));
+    STACK_STATS_POPPED(s, count);
+    return count;
 }
 
 /**
@@ -85,6 +83,7 @@ void stack_empty(Stack* s) {
         return;
     }
 
+    STACK_STATS_POPPED(s, s->top + 1);
     s->top = -1;  // Restablecemos el top a -1 para vaciar la pila
 }
 
@@ -103,9 +102,25 @@ void stack_print(Stack *s) {
         return;
     }
 
-    // Imprime los elementos desde el top hasta la base de la pila
-    for (int i = s->top; i >= 0; i--) {
-        printf("%d ", s->data[i]);
+    // Los datos se escriben con stack_write_text en bloques grandes y no con un printf por
+    // dato; lo que stdio tenga pendiente sale antes para conservar el orden de la salida
+    fflush(stdout);
+    stack_write_text(s, fileno(stdout));
+}
+
+#ifdef STACK_STATS
+/**
+ * Devuelve una copia de las estadísticas de uso de la pila.
+ * 
+ * @param s Referencia a la pila.
+ * @return Los contadores acumulados desde `stack_create`; todos en 0 si `s` es NULL.
+ * @details Solo existe al compilar con -DSTACK_STATS. La cantidad actual de elementos es
+ *          pushes - pops; comparar high_water con MAX_SIZE indica qué tan cerca estuvo de llenarse.
+ */
+StackStats stack_stats(const Stack* s) {
+    if (s == NULL) {
+        return (StackStats){0};
     }
-    printf("\n");
+    return s->stats;
 }
+#endif
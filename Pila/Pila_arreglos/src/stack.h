@@ -2,24 +2,109 @@
 #define __STACK_H__
 
 #include <stdbool.h>
+#include <stddef.h>
 
 // Definimos el tamaño máximo de la pila
 #define MAX_SIZE 100  // Cambié 'TAM' por 'MAX_SIZE' como convención
 
 typedef int Data;  // Definimos que 'Data' es de tipo int, ajusta según necesites
 
+// Estadísticas de uso: al compilar con -DSTACK_STATS cada pila lleva estos contadores y
+// `stack_stats` devuelve una copia. Sin la bandera la estructura no cambia y los macros
+// STACK_STATS_* no generan código.
+#ifdef STACK_STATS
+typedef struct {
+    unsigned long pushes;      // Elementos insertados
+    unsigned long pops;        // Elementos que salieron de la pila (pop o vaciado)
+    unsigned long rejected;    // Inserciones descartadas porque la pila estaba llena
+    unsigned long grows;       // Veces que creció la capacidad (siempre 0: es fija)
+    unsigned long allocs;      // Reservas de memoria (siempre 0: el arreglo es parte de Stack)
+    size_t bytes;              // Bytes que ocupa el arreglo de datos
+    unsigned long high_water;  // Máximo de elementos guardados a la vez
+} StackStats;
+
+#define STACK_STATS_ADD(s, field, n) ((s)->stats.field += (n))
+#define STACK_STATS_SET(s, field, v) ((s)->stats.field = (v))
+#define STACK_STATS_PUSHED(s, n) stack_stats_pushed(&(s)->stats, (n))
+#define STACK_STATS_POPPED(s, n) ((s)->stats.pops += (n))
+
+// Cuenta n inserciones y actualiza el máximo de elementos (pushes - pops)
+static inline void stack_stats_pushed(StackStats* st, unsigned long n) {
+    st->pushes += n;
+    if (st->pushes - st->pops > st->high_water) {
+        st->high_water = st->pushes - st->pops;
+    }
+}
+#else
+#define STACK_STATS_ADD(s, field, n) ((void)0)
+#define STACK_STATS_SET(s, field, v) ((void)0)
+#define STACK_STATS_PUSHED(s, n) ((void)0)
+#define STACK_STATS_POPPED(s, n) ((void)0)
+#endif
+
 // Definimos la estructura de la pila
 typedef struct {
     Data data[MAX_SIZE];  // Arreglo que contiene los elementos de la pila
     int top;  // Índice que apunta al elemento superior de la pila
+#ifdef STACK_STATS
+    StackStats stats;
+#endif
 } Stack;
 
 // Declaración de las funciones
 Stack stack_create();
-void stack_push(Stack*, Data);
-Data stack_pop(Stack*);
-bool stack_is_empty(Stack*);
+int stack_push_n(Stack*, const Data*, int);
+int stack_pop_n(Stack*, Data*, int);
 void stack_empty(Stack*);
 void stack_print(Stack *);
+#ifdef STACK_STATS
+StackStats stack_stats(const Stack*);
+#endif
+
+// Búsquedas y reducciones sobre los datos de la pila (stack_simd.c). Recorren el arreglo
+// con AVX2 o SSE4.1 si el procesador las tiene; stack_simd_use permite fijar el nivel.
+typedef enum {
+    STACK_SIMD_SCALAR,
+    STACK_SIMD_SSE4,
+    STACK_SIMD_AVX2
+} StackSimdLevel;
+
+bool stack_contains(const Stack*, Data);
+int stack_count(const Stack*, Data);
+long long stack_sum(const Stack*);
+bool stack_min(const Stack*, Data*);
+StackSimdLevel stack_simd_use(StackSimdLevel);
+
+// Exportación e importación en bloque (stack_io.c), a un buffer o a un descriptor. El formato
+// binario son los datos en crudo de la base al top; el de texto es el de stack_print.
+size_t stack_export_bin(const Stack*, void*, size_t);
+bool stack_write_bin(const Stack*, int);
+int stack_import_bin(Stack*, const void*, size_t);
+int stack_read_bin(Stack*, int);
+size_t stack_export_text(const Stack*, char*, size_t);
+bool stack_write_text(const Stack*, int);
+int stack_import_text(Stack*, const char*, size_t);
+
+// Modo sin verificaciones: con -DSTACK_UNCHECKED las comprobaciones defensivas de apuntadores
+// NULL en las operaciones frecuentes se vuelven assert, que solo existen en compilaciones de
+// depuración; con -DNDEBUG además desaparecen del código. Las verificaciones de pila vacía o llena
+// se conservan, porque forman parte del resultado de las funciones.
+#ifdef STACK_UNCHECKED
+#include <assert.h>
+#define STACK_INVALID(p) (assert((p) != NULL), false)
+#else
+#define STACK_INVALID(p) ((p) == NULL)
+#endif
+
+// Operaciones frecuentes: con -DSTACK_HEADER_ONLY se definen como static inline en stack_inline.h
+#ifdef STACK_HEADER_ONLY
+#define STACK_INLINE static inline
+#include "stack_inline.h"
+#else
+void stack_push(Stack*, Data);
+Data stack_pop(Stack*);
+bool stack_try_pop(Stack*, Data*);
+int stack_is_empty(Stack*);
+#endif
 
 #endif // __STACK_H__
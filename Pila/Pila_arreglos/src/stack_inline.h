@@ -0,0 +1,93 @@
+#ifndef __STACK_INLINE_H__
+#define __STACK_INLINE_H__
+#include <stddef.h>
+
+// Operaciones frecuentes de la pila. Este archivo no se incluye directamente:
+// stack.h lo incluye con STACK_INLINE = static inline cuando se compila con -DSTACK_HEADER_ONLY,
+// para que el compilador pueda integrarlas en el código que las llama, y stack.c lo incluye
+// con STACK_INLINE vacío para generar las versiones normales.
+
+/**
+ * Verifica si la pila está vacía.
+ * 
+ * @param s Referencia a la pila que se desea verificar.
+ * @return 1 si la pila está vacía, 0 si no lo está. Si el puntero `s` es NULL, devuelve -1.
+ * @details Esta función comprueba si la pila no contiene elementos. Es útil para evitar operaciones
+ *          como `stack_pop` en una pila vacía.
+ */
+STACK_INLINE int stack_is_empty(Stack* s) {
+    if (STACK_INVALID(s)) {
+        return -1;  // Si la pila es NULL, devolvemos -1
+    }
+
+    return s->top == -1 ? 1 : 0;  // Si top es -1, la pila está vacía
+}
+
+/**
+ * Inserta un elemento en la parte superior de la pila.
+ * 
+ * @param s Referencia a la pila donde se insertará el elemento.
+ * @param d Dato que se insertará en la pila.
+ * @details Esta función añade el dato `d` en la parte superior de la pila. Si la pila está llena, 
+ *          la función no realiza ninguna operación.
+ */
+STACK_INLINE void stack_push(Stack* s, Data d) {
+    if (STACK_INVALID(s)) {
+        return;  // Si el puntero a la pila es NULL, no hacemos nada
+    }
+    
+    // Verificamos si la pila está llena, si lo está no podemos insertar más elementos
+    if (s->top == MAX_SIZE - 1) {
+        STACK_STATS_ADD(s, rejected, 1);
+        return;
+    }
+
+    // Incrementamos el top y añadimos el dato en la nueva posición
+    s->top++;
+    s->data[s->top] = d;
+    STACK_STATS_PUSHED(s, 1);
+}
+
+/**
+ * Elimina y devuelve el elemento en la parte superior de la pila.
+ * 
+ * @param s Referencia a la pila de la cual se eliminará el elemento.
+ * @return El dato que estaba en la parte superior de la pila. Si la pila está vacía 
+ *         devuelve un valor que indica error (por ejemplo, -1 o un valor predeterminado).
+ * @details Esta función elimina el elemento en la parte superior de la pila y lo devuelve.
+ *          Si la pila está vacía, no se realiza ninguna operación y se devuelve un valor de error.
+ */
+STACK_INLINE Data stack_pop(Stack* s) {
+    Data error_value = -1;  // Valor de error en caso de que la pila esté vacía
+    if (STACK_INVALID(s) || s->top == -1) {
+        return error_value;  // Si la pila es NULL o está vacía, devolvemos un valor de error
+    }
+
+    // Extraemos el dato en la parte superior de la pila
+    Data top = s->data[s->top];
+    s->top--;  // Reducimos el top de la pila
+    STACK_STATS_POPPED(s, 1);
+
+    return top;
+}
+
+/**
+ * Intenta extraer el elemento en la parte superior de la pila.
+ * 
+ * @param s Referencia a la pila de la cual se extraerá el elemento.
+ * @param out Donde se guarda el dato extraído.
+ * @return `true` si se extrajo un dato, `false` si la pila está vacía (out no cambia).
+ * @details A diferencia de `stack_pop`, no hay un valor de error que se confunda con un dato,
+ *          así que no hace falta llamar antes a `stack_is_empty`: la pila se revisa una sola vez.
+ */
+STACK_INLINE bool stack_try_pop(Stack* s, Data* out) {
+    if (STACK_INVALID(s) || STACK_INVALID(out) || s->top == -1) {
+        return false;
+    }
+    *out = s->data[s->top];
+    s->top--;
+    STACK_STATS_POPPED(s, 1);
+    return true;
+}
+
+#endif // __STACK_INLINE_H__
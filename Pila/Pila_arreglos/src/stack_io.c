@@ -0,0 +1,322 @@
+#define _POSIX_C_SOURCE 200112L  // read, write
+#include "stack.h"
+#include <ctype.h>
+#include <errno.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// Tamaño de los bloques que se escriben o leen de un descriptor (64 KiB)
+#define IO_CHUNK (1 << 16)
+#define IO_CHUNK_DATA (IO_CHUNK / (int)sizeof(Data))
+
+// Máximo de caracteres de un dato en texto: signo, 10 dígitos y el espacio que lo sigue
+#define TEXT_MAX 12
+
+// Pares de dígitos "00" a "99": la conversión a decimal saca dos dígitos por división
+static const char digit_pairs[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+// Escribe buf completo en fd, reintentando las escrituras parciales o interrumpidas
+static bool write_all(int fd, const void* buf, size_t len) {
+    const char* p = (const char*) buf;
+    while (len > 0) {
+        ssize_t w = write(fd, p, len);
+        if (w < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        p += w;
+        len -= (size_t) w;
+    }
+    return true;
+}
+
+// Escribe d en decimal seguido de un espacio a partir de out; devuelve los caracteres escritos
+static size_t text_put(char* out, Data d) {
+    char tmp[TEXT_MAX];
+    char* end = tmp + TEXT_MAX;
+    char* p = end;
+    unsigned int u = d < 0 ? 0u - (unsigned int) d : (unsigned int) d;
+
+    *--p = ' ';
+    while (u >= 100) {
+        unsigned int r = u % 100;
+        u /= 100;
+        p -= 2;
+        memcpy(p, &digit_pairs[2 * r], 2);
+    }
+    if (u >= 10) {
+        p -= 2;
+        memcpy(p, &digit_pairs[2 * u], 2);
+    } else {
+        *--p = (char) ('0' + u);
+    }
+    if (d < 0) {
+        *--p = '-';
+    }
+    memcpy(out, p, (size_t) (end - p));
+    return (size_t) (end - p);
+}
+
+// Caracteres que ocupa d en texto, contando el espacio que lo sigue
+static size_t text_len(Data d) {
+    unsigned int u = d < 0 ? 0u - (unsigned int) d : (unsigned int) d;
+    size_t len = d < 0 ? 3 : 2;
+    while (u >= 10) {
+        u /= 10;
+        len++;
+    }
+    return len;
+}
+
+// Lee los enteros separados por espacios de buf[0 .. len-1] y los guarda en out, que debe tener
+// lugar para (len + 1) / 2 datos; devuelve cuántos leyó o -1 si algo no es un dato válido
+static long text_parse(const char* buf, size_t len, Data* out) {
+    size_t i = 0;
+    long n = 0;
+    for (;;) {
+        while (i < len && isspace((unsigned char) buf[i])) {
+            i++;
+        }
+        if (i == len) {
+            return n;
+        }
+
+        bool neg = buf[i] == '-';
+        if (neg || buf[i] == '+') {
+            i++;
+        }
+        if (i == len || !isdigit((unsigned char) buf[i])) {
+            return -1;
+        }
+        unsigned long long limit = neg ? (unsigned long long) INT_MAX + 1 : INT_MAX;
+        unsigned long long v = 0;
+        while (i < len && isdigit((unsigned char) buf[i])) {
+            v = v * 10 + (unsigned long long) (buf[i++] - '0');
+            if (v > limit) {
+                return -1;
+            }
+        }
+        if (i < len && !isspace((unsigned char) buf[i])) {
+            return -1;
+        }
+        out[n++] = neg ? (Data) (-(long long) v) : (Data) v;
+    }
+}
+
+/**
+ * Copia los datos de la pila en un buffer, en binario.
+ *
+ * @param s Referencia a la pila.
+ * @param buf Buffer de destino; puede ser NULL para solo consultar el tamaño.
+ * @param cap Bytes disponibles en `buf`.
+ * @return Bytes que ocupa la exportación completa: (elementos) * sizeof(Data). Si `buf` es NULL
+ *         o `cap` no alcanza, no se escribe nada. Devuelve 0 si `s` es NULL.
+ * @details El formato son los datos en crudo, de la base al top, así que es un solo `memcpy` del
+ *          arreglo. `stack_import_bin` lo vuelve a cargar.
+ */
+size_t stack_export_bin(const Stack* s, void* buf, size_t cap) {
+    if (s == NULL) {
+        return 0;
+    }
+    size_t len = (size_t) (s->top + 1) * sizeof(Data);
+    if (buf != NULL && len <= cap) {
+        memcpy(buf, s->data, len);
+    }
+    return len;
+}
+
+/**
+ * Escribe los datos de la pila en un descriptor, en el mismo formato que `stack_export_bin`.
+ *
+ * @param s Referencia a la pila.
+ * @param fd Descriptor abierto para escritura (archivo, pipe o socket).
+ * @return `true` si se escribió todo, `false` si `s` es NULL o falló `write`.
+ * @details El arreglo se entrega completo a `write`, sin copias intermedias; solo se repite la
+ *          llamada si el sistema acepta una escritura parcial.
+ */
+bool stack_write_bin(const Stack* s, int fd) {
+    if (s == NULL) {
+        return false;
+    }
+    return write_all(fd, s->data, (size_t) (s->top + 1) * sizeof(Data));
+}
+
+/**
+ * Inserta en la pila los datos de un buffer binario, como los deja `stack_export_bin`.
+ *
+ * @param s Referencia a la pila.
+ * @param buf Datos en crudo, de la base al top; no necesita estar alineado.
+ * @param len Bytes en `buf`, múltiplo de sizeof(Data).
+ * @return Cantidad de datos insertados (menor si la pila se llenó), o -1 si `s` o `buf` son NULL
+ *         o `len` no es múltiplo de sizeof(Data).
+ * @details Los datos se agregan encima de los que ya tenga la pila con `stack_push_n`. Si `buf`
+ *          no está alineado para Data se copia antes por bloques a un arreglo alineado.
+ */
+int stack_import_bin(Stack* s, const void* buf, size_t len) {
+    if (s == NULL || buf == NULL || len % sizeof(Data) != 0 || len / sizeof(Data) > INT_MAX) {
+        return -1;
+    }
+    int n = (int) (len / sizeof(Data));
+    if ((uintptr_t) buf % sizeof(Data) == 0) {
+        return n > 0 ? stack_push_n(s, (const Data*) buf, n) : 0;
+    }
+
+    Data chunk[IO_CHUNK_DATA];
+    const char* p = (const char*) buf;
+    int count = 0;
+    while (count < n) {
+        int m = n - count < IO_CHUNK_DATA ? n - count : IO_CHUNK_DATA;
+        memcpy(chunk, p + (size_t) count * sizeof(Data), (size_t) m * sizeof(Data));
+        int pushed = stack_push_n(s, chunk, m);
+        count += pushed;
+        if (pushed < m) {
+            break;
+        }
+    }
+    return count;
+}
+
+/**
+ * Inserta en la pila los datos binarios que se lean de un descriptor hasta el fin de archivo.
+ *
+ * @param s Referencia a la pila.
+ * @param fd Descriptor abierto para lectura, con datos como los escribe `stack_write_bin`.
+ * @return Cantidad de datos insertados, o -1 si `s` es NULL, falló `read` o la entrada terminó a
+ *         mitad de un dato. Si la pila se llena deja de leer y devuelve lo insertado.
+ * @details Lee en bloques de IO_CHUNK bytes y los inserta con `stack_push_n`. Ante un error los
+ *          datos ya leídos quedan en la pila.
+ */
+int stack_read_bin(Stack* s, int fd) {
+    if (s == NULL) {
+        return -1;
+    }
+    Data chunk[IO_CHUNK_DATA];
+    char* bytes = (char*) chunk;
+    size_t have = 0;  // Bytes leídos que aún no se insertan
+    int count = 0;
+    for (;;) {
+        ssize_t r = read(fd, bytes + have, sizeof(chunk) - have);
+        if (r < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        }
+        if (r == 0) {
+            return have == 0 ? count : -1;
+        }
+        have += (size_t) r;
+        int n = (int) (have / sizeof(Data));
+        if (n > 0) {
+            int pushed = stack_push_n(s, chunk, n);
+            count += pushed;
+            if (pushed < n) {
+                return count;
+            }
+            have -= (size_t) n * sizeof(Data);
+            memmove(bytes, bytes + (size_t) n * sizeof(Data), have);
+        }
+    }
+}
+
+/**
+ * Escribe los datos de la pila en un buffer como texto, en el formato de `stack_print`.
+ *
+ * @param s Referencia a la pila.
+ * @param buf Buffer de destino; puede ser NULL para solo consultar el tamaño.
+ * @param cap Bytes disponibles en `buf`.
+ * @return Bytes que ocupa el texto completo. Si `buf` es NULL o `cap` no alcanza, no se escribe
+ *         nada. Devuelve 0 si `s` es NULL.
+ * @details Cada dato va en decimal seguido de un espacio, del top a la base, y al final un salto
+ *          de línea; no se agrega terminador '\0'. La conversión no usa stdio.
+ */
+size_t stack_export_text(const Stack* s, char* buf, size_t cap) {
+    if (s == NULL) {
+        return 0;
+    }
+    size_t len = 1;
+    for (int i = s->top; i >= 0; i--) {
+        len += text_len(s->data[i]);
+    }
+    if (buf == NULL || len > cap) {
+        return len;
+    }
+
+    char* p = buf;
+    for (int i = s->top; i >= 0; i--) {
+        p += text_put(p, s->data[i]);
+    }
+    *p = '\n';
+    return len;
+}
+
+/**
+ * Escribe los datos de la pila en un descriptor como texto, en el formato de `stack_export_text`.
+ *
+ * @param s Referencia a la pila.
+ * @param fd Descriptor abierto para escritura.
+ * @return `true` si se escribió todo, `false` si `s` es NULL o falló `write`.
+ * @details El texto se arma en un buffer de IO_CHUNK bytes que se escribe cada vez que se llena,
+ *          en lugar de una llamada por dato.
+ */
+bool stack_write_text(const Stack* s, int fd) {
+    if (s == NULL) {
+        return false;
+    }
+    char buf[IO_CHUNK];
+    size_t used = 0;
+    for (int i = s->top; i >= 0; i--) {
+        if (IO_CHUNK - used <= TEXT_MAX) {
+            if (!write_all(fd, buf, used)) {
+                return false;
+            }
+            used = 0;
+        }
+        used += text_put(buf + used, s->data[i]);
+    }
+    buf[used++] = '\n';
+    return write_all(fd, buf, used);
+}
+
+/**
+ * Inserta en la pila los datos de un texto como el que deja `stack_export_text`.
+ *
+ * @param s Referencia a la pila.
+ * @param buf Enteros en decimal separados por espacios en blanco, del top a la base.
+ * @param len Caracteres en `buf`; no hace falta un terminador '\0'.
+ * @return Cantidad de datos insertados (menor si la pila se llenó), o -1 si `s` o `buf` son NULL,
+ *         no hubo memoria o el texto tiene algo que no es un dato válido; en ese caso la pila no
+ *         cambia.
+ * @details El texto se convierte completo a un arreglo temporal, que se invierte para insertarlo
+ *          con un solo `stack_push_n`: el primer número del texto queda en el top.
+ */
+int stack_import_text(Stack* s, const char* buf, size_t len) {
+    if (s == NULL || buf == NULL) {
+        return -1;
+    }
+    Data* tmp = (Data*) malloc(((len + 1) / 2 + 1) * sizeof(Data));
+    if (tmp == NULL) {
+        return -1;
+    }
+    long n = text_parse(buf, len, tmp);
+    if (n < 0 || n > INT_MAX) {
+        free(tmp);
+        return -1;
+    }
+    for (long i = 0, j = n - 1; i < j; i++, j--) {
+        Data d = tmp[i];
+        tmp[i] = tmp[j];
+        tmp[j] = d;
+    }
+    int count = n > 0 ? stack_push_n(s, tmp, (int) n) : 0;
+    free(tmp);
+    return count;
+}
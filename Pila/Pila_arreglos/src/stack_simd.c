@@ -0,0 +1,86 @@
+#include "stack.h"
+#include "simd_kernels.h"
+
+static const SimdKernels* kernels = NULL;  // Juego de recorridos elegido; NULL hasta el primer uso
+
+/**
+ * Fija el nivel de instrucciones que usan las búsquedas y reducciones.
+ * 
+ * @param level Nivel deseado.
+ * @return El nivel que quedó en uso: el pedido, o el más alto que soporte el procesador si
+ *         el pedido no está disponible.
+ * @details No hace falta llamarla: en el primer uso se elige el nivel más alto disponible.
+ *          Sirve para comparar las versiones o para forzar la versión escalar.
+ */
+StackSimdLevel stack_simd_use(StackSimdLevel level) {
+    int max = simd_cpu_level();
+    if ((int)level > max) {
+        level = (StackSimdLevel)max;
+    }
+    kernels = simd_kernels_for(level);
+    return level;
+}
+
+// Juego de recorridos en uso; lo elige la primera vez que se necesita
+static const SimdKernels* stack_kernels(void) {
+    if (kernels == NULL) {
+        stack_simd_use(STACK_SIMD_AVX2);
+    }
+    return kernels;
+}
+
+/**
+ * Verifica si un dato está en la pila, sin extraer nada.
+ * 
+ * @param s Referencia a la pila.
+ * @param d Dato que se busca.
+ * @return `true` si algún elemento de la pila es igual a `d`; `false` si no, o si `s` es NULL.
+ */
+bool stack_contains(const Stack* s, Data d) {
+    if (s == NULL) {
+        return false;
+    }
+    return stack_kernels()->find(s->data, s->top + 1, d) >= 0;
+}
+
+/**
+ * Cuenta cuántos elementos de la pila son iguales a un dato.
+ * 
+ * @param s Referencia a la pila.
+ * @param d Dato que se cuenta.
+ * @return Cantidad de apariciones de `d` (0 si `s` es NULL).
+ */
+int stack_count(const Stack* s, Data d) {
+    if (s == NULL) {
+        return 0;
+    }
+    return stack_kernels()->count(s->data, s->top + 1, d);
+}
+
+/**
+ * Suma los elementos de la pila.
+ * 
+ * @param s Referencia a la pila.
+ * @return La suma, acumulada en 64 bits para que no se desborde (0 si la pila está vacía o `s` es NULL).
+ */
+long long stack_sum(const Stack* s) {
+    if (s == NULL) {
+        return 0;
+    }
+    return stack_kernels()->sum(s->data, s->top + 1);
+}
+
+/**
+ * Obtiene el menor elemento de la pila.
+ * 
+ * @param s Referencia a la pila.
+ * @param out Donde se guarda el menor dato.
+ * @return `true` si la pila tenía datos, `false` si está vacía o `s` es NULL (out no cambia).
+ */
+bool stack_min(const Stack* s, Data* out) {
+    if (s == NULL || out == NULL || s->top < 0) {
+        return false;
+    }
+    *out = stack_kernels()->min(s->data, s->top + 1);
+    return true;
+}
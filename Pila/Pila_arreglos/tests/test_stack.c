@@ -1,4 +1,9 @@
+#define _POSIX_C_SOURCE 200112L  // fileno, lseek
 #include <check.h>
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
 #include "../src/stack.h"
 
 START_TEST(test_stack_init) {
@@ -19,6 +24,157 @@ START_TEST(test_stack_push_pop) {
 }
 END_TEST
 
+START_TEST(test_stack_push_pop_n) {
+    Stack stack =  stack_create();
+    Data in[MAX_SIZE + 10];
+    Data out[MAX_SIZE + 10];
+
+    for (int i = 0; i < MAX_SIZE + 10; i++) {
+        in[i] = i;
+    }
+    ck_assert_int_eq(stack_push_n(&stack, in, 3), 3);
+    ck_assert_int_eq(stack_pop(&stack), 2);
+
+    // Solo caben MAX_SIZE elementos en total
+    ck_assert_int_eq(stack_push_n(&stack, in, MAX_SIZE + 10), MAX_SIZE - 2);
+    ck_assert_int_eq(stack_pop_n(&stack, out, MAX_SIZE + 10), MAX_SIZE);
+    ck_assert_int_eq(out[0], 0);
+    ck_assert_int_eq(out[1], 1);
+    ck_assert_int_eq(out[MAX_SIZE - 1], MAX_SIZE - 3);
+    ck_assert(stack_is_empty(&stack));
+}
+END_TEST
+
+#ifdef STACK_STATS
+START_TEST(test_stack_stats) {
+    Stack stack = stack_create();
+    Data in[MAX_SIZE + 5] = {0};
+
+    stack_push(&stack, 1);
+    stack_push(&stack, 2);
+    stack_pop(&stack);
+    ck_assert_int_eq(stack_push_n(&stack, in, MAX_SIZE + 5), MAX_SIZE - 1);
+    stack_push(&stack, 3);  // La pila está llena: se descarta
+
+    StackStats st = stack_stats(&stack);
+    ck_assert_uint_eq(st.pushes, MAX_SIZE + 1);
+    ck_assert_uint_eq(st.pops, 1);
+    ck_assert_uint_eq(st.rejected, 7);
+    ck_assert_uint_eq(st.high_water, MAX_SIZE);
+    ck_assert_uint_eq(st.bytes, MAX_SIZE * sizeof(Data));
+
+    stack_empty(&stack);
+    st = stack_stats(&stack);
+    ck_assert_uint_eq(st.pushes - st.pops, 0);
+    ck_assert_uint_eq(st.high_water, MAX_SIZE);
+}
+END_TEST
+#endif
+
+START_TEST(test_stack_try_pop) {
+    Stack stack = stack_create();
+    Data d = 99;
+
+    ck_assert(!stack_try_pop(&stack, &d));
+    ck_assert_int_eq(d, 99);  // Sin datos, out no cambia
+
+    // -1 es un dato como cualquier otro: try_pop lo distingue de una pila vacía
+    stack_push(&stack, -1);
+    stack_push(&stack, 5);
+    stack_push(&stack, 6);
+    ck_assert(stack_try_pop(&stack, &d));
+    ck_assert_int_eq(d, 6);
+    ck_assert(stack_try_pop(&stack, &d));
+    ck_assert_int_eq(d, 5);
+    ck_assert(stack_try_pop(&stack, &d));
+    ck_assert_int_eq(d, -1);
+    ck_assert(!stack_try_pop(&stack, &d));
+    ck_assert(stack_is_empty(&stack));
+}
+END_TEST
+
+START_TEST(test_stack_simd) {
+    Stack stack = stack_create();
+    Data d;
+
+    ck_assert(!stack_contains(&stack, 0));
+    ck_assert(!stack_min(&stack, &d));
+    ck_assert(stack_sum(&stack) == 0);
+
+    // Datos grandes para que la suma no quepa en 32 bits; el 7 aparece cada 9 posiciones
+    long long expected_sum = 0;
+    for (int i = 0; i < MAX_SIZE - 1; i++) {
+        Data v = i % 9 == 0 ? 7 : 2000000000 - i;
+        stack_push(&stack, v);
+        expected_sum += v;
+    }
+    stack_push(&stack, -5);  // El menor queda en el top, fuera de los bloques completos
+    expected_sum += -5;
+
+    // Cada nivel disponible debe dar los mismos resultados que la versión escalar
+    for (int level = STACK_SIMD_SCALAR; level <= STACK_SIMD_AVX2; level++) {
+        stack_simd_use((StackSimdLevel)level);
+        ck_assert(stack_contains(&stack, 7));
+        ck_assert(stack_contains(&stack, -5));
+        ck_assert(!stack_contains(&stack, 8));
+        ck_assert_int_eq(stack_count(&stack, 7), (MAX_SIZE - 2) / 9 + 1);
+        ck_assert(stack_sum(&stack) == expected_sum);
+        ck_assert(stack_min(&stack, &d));
+        ck_assert_int_eq(d, -5);
+    }
+    stack_simd_use(STACK_SIMD_AVX2);
+}
+END_TEST
+
+START_TEST(test_stack_io) {
+    Stack stack = stack_create();
+    Data in[] = {5, -12, 0, INT_MAX, INT_MIN, 100, -7};
+    int n = sizeof(in) / sizeof(in[0]);
+    stack_push_n(&stack, in, n);
+
+    // Texto: el formato de stack_print, del top a la base
+    const char expected[] = "-7 100 -2147483648 2147483647 0 -12 5 \n";
+    size_t text_len = strlen(expected);
+    char text[64];
+    ck_assert_uint_eq(stack_export_text(&stack, NULL, 0), text_len);
+    ck_assert_uint_eq(stack_export_text(&stack, text, sizeof(text)), text_len);
+    ck_assert(memcmp(text, expected, text_len) == 0);
+
+    Stack copy = stack_create();
+    ck_assert_int_eq(stack_import_text(&copy, text, text_len), n);
+    ck_assert_int_eq(stack_import_text(&copy, "1 2x", 4), -1);  // Inválidos: la pila no cambia
+    ck_assert_int_eq(stack_import_text(&copy, "2147483648", 10), -1);
+
+    // Binario: datos en crudo de la base al top, importados desde una posición sin alinear
+    char bin[1 + sizeof(in)];
+    ck_assert_uint_eq(stack_export_bin(&stack, bin + 1, 3), sizeof(in));  // No cabe: no escribe
+    ck_assert_uint_eq(stack_export_bin(&stack, bin + 1, sizeof(in)), sizeof(in));
+    ck_assert(memcmp(bin + 1, in, sizeof(in)) == 0);
+    ck_assert_int_eq(stack_import_bin(&copy, bin + 1, sizeof(in)), n);
+    ck_assert_int_eq(stack_import_bin(&copy, bin + 1, 3), -1);
+
+    // Descriptor: se escribe en un archivo temporal y se vuelve a leer
+    FILE* f = tmpfile();
+    ck_assert_ptr_nonnull(f);
+    ck_assert(stack_write_bin(&stack, fileno(f)));
+    lseek(fileno(f), 0, SEEK_SET);
+    ck_assert_int_eq(stack_read_bin(&copy, fileno(f)), n);
+    fclose(f);
+
+    // copy tiene la pila tres veces; cada stack_pop_n devuelve los datos originales
+    Data out[7];
+    for (int k = 0; k < 3; k++) {
+        ck_assert_int_eq(stack_pop_n(&copy, out, n), n);
+        ck_assert(memcmp(out, in, sizeof(in)) == 0);
+    }
+    ck_assert(stack_is_empty(&copy));
+
+    // Una pila llena solo admite lo que cabe
+    Data many[MAX_SIZE + 10] = {0};
+    ck_assert_int_eq(stack_import_bin(&copy, many, sizeof(many)), MAX_SIZE);
+}
+END_TEST
+
 Suite* stack_suite(void) {
     Suite* s;
     TCase* tc_core;
@@ -28,6 +184,13 @@ Suite* stack_suite(void) {
     tc_core = tcase_create("Core");
     tcase_add_test(tc_core, test_stack_init);
     tcase_add_test(tc_core, test_stack_push_pop);
+    tcase_add_test(tc_core, test_stack_push_pop_n);
+#ifdef STACK_STATS
+    tcase_add_test(tc_core, test_stack_stats);
+#endif
+    tcase_add_test(tc_core, test_stack_try_pop);
+    tcase_add_test(tc_core, test_stack_simd);
+    tcase_add_test(tc_core, test_stack_io);
     suite_add_tcase(s, tc_core);
 
     return s;
@@ -0,0 +1,154 @@
+#define _POSIX_C_SOURCE 200809L  // clock_gettime
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../src/stack_ws.h"
+
+// Ejemplo fork-join con robo de trabajo: fib(n) en paralelo, de 1 hilo a hilos_max.
+// Cada trabajador tiene su StackWS de tareas. Una tarea fib(k) con k >= CUTOFF se divide en
+// fib(k - 1) y fib(k - 2), que el trabajador inserta en su propia pila; por debajo de CUTOFF se
+// calcula en serie y se suma al resultado del trabajador. Un trabajador sin tareas roba la más
+// vieja (la más grande) de otro trabajador elegido al azar.
+// Uso: ./bench_fib [n] [hilos_max]   (por defecto n = 38 y hilos_max = 8)
+
+#define CUTOFF 20
+#define MAX_WORKERS 64
+#define MAX_N 50  // fib_seq es exponencial: más allá la versión en serie no termina en tiempo útil
+
+typedef struct {
+    StackWS* tasks;
+    long sum;  // Suma de las hojas calculadas por este trabajador
+    long steals;
+    int id;
+} Worker;
+
+static Worker workers[MAX_WORKERS];
+static int n_workers;
+static atomic_long pending;  // Tareas creadas que aún no terminan
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static long fib_seq(int n) {
+    return n < 2 ? n : fib_seq(n - 1) + fib_seq(n - 2);
+}
+
+// Inserta una tarea en la pila del trabajador; sin memoria para crecer no hay forma de seguir
+static void push_task(StackWS* tasks, int n) {
+    if (!stack_ws_push(tasks, n)) {
+        fprintf(stderr, "bench_fib: no hay memoria para la tarea fib(%d)\n", n);
+        exit(1);
+    }
+}
+
+// Ejecuta una tarea: la divide en dos subtareas o la resuelve en serie
+static void run_task(Worker* w, int n) {
+    if (n < CUTOFF) {
+        w->sum += fib_seq(n);
+        atomic_fetch_sub_explicit(&pending, 1, memory_order_release);
+        return;
+    }
+    // Dos tareas nuevas y una terminada: pending aumenta en uno
+    atomic_fetch_add_explicit(&pending, 1, memory_order_relaxed);
+    push_task(w->tasks, n - 2);
+    push_task(w->tasks, n - 1);
+}
+
+static void* worker_main(void* arg) {
+    Worker* w = (Worker*)arg;
+    uint32_t rng = (uint32_t)w->id * 2654435761u | 1;
+    Data n;
+
+    while (atomic_load_explicit(&pending, memory_order_acquire) > 0) {
+        if (stack_ws_pop(w->tasks, &n)) {
+            run_task(w, n);
+            continue;
+        }
+        rng ^= rng << 13;
+        rng ^= rng >> 17;
+        rng ^= rng << 5;
+        Worker* victim = &workers[rng % n_workers];
+        if (victim != w && stack_ws_steal(victim->tasks, &n) == STACK_WS_OK) {
+            w->steals++;
+            run_task(w, n);
+        } else {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+// Calcula fib(n) con `threads` trabajadores; el hilo principal es el trabajador 0
+static long fib_parallel(int n, int threads, double* seconds, long* steals) {
+    pthread_t tids[MAX_WORKERS];
+    n_workers = threads;
+    for (int i = 0; i < threads; i++) {
+        workers[i].tasks = stack_ws_create();
+        if (workers[i].tasks == NULL) {
+            fprintf(stderr, "bench_fib: no hay memoria para el trabajador %d\n", i);
+            exit(1);
+        }
+        workers[i].sum = 0;
+        workers[i].steals = 0;
+        workers[i].id = i + 1;
+    }
+
+    double start = now();
+    atomic_store(&pending, 1);
+    push_task(workers[0].tasks, n);
+    for (int i = 1; i < threads; i++) {
+        pthread_create(&tids[i], NULL, worker_main, &workers[i]);
+    }
+    worker_main(&workers[0]);
+    for (int i = 1; i < threads; i++) {
+        pthread_join(tids[i], NULL);
+    }
+    *seconds = now() - start;
+
+    long result = 0;
+    *steals = 0;
+    for (int i = 0; i < threads; i++) {
+        result += workers[i].sum;
+        *steals += workers[i].steals;
+        stack_ws_delete(workers[i].tasks);
+    }
+    return result;
+}
+
+int main(int argc, char** argv) {
+    int n = argc > 1 ? atoi(argv[1]) : 38;
+    int max_threads = argc > 2 ? atoi(argv[2]) : 8;
+    if (n <= 0 || n > MAX_N) {
+        fprintf(stderr, "%s: n debe estar entre 1 y %d\n", argv[0], MAX_N);
+        return 1;
+    }
+    if (max_threads <= 0 || max_threads > MAX_WORKERS) {
+        fprintf(stderr, "%s: hilos_max debe estar entre 1 y %d\n", argv[0], MAX_WORKERS);
+        return 1;
+    }
+
+    double start = now();
+    long expected = fib_seq(n);
+    double serial = now() - start;
+
+    printf("hilos,segundos,aceleracion,robos\n");
+    printf("serie,%.3f,1.00,0\n", serial);
+    for (int threads = 1; threads <= max_threads; threads *= 2) {
+        double seconds;
+        long steals;
+        long result = fib_parallel(n, threads, &seconds, &steals);
+        if (result != expected) {
+            fprintf(stderr, "fib(%d) = %ld, se esperaba %ld\n", n, result, expected);
+            return 1;
+        }
+        printf("%d,%.3f,%.2f,%ld\n", threads, seconds, serial / seconds, steals);
+    }
+    return 0;
+}
@@ -1,91 +1,143 @@
+#define _POSIX_C_SOURCE 200112L  // fileno
 #include "stack.h"
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+
+// Versiones normales (no inline) de las operaciones frecuentes
+#ifndef STACK_HEADER_ONLY
+#define STACK_INLINE
+#include "stack_inline.h"
+#endif
 
 /**
  * Crea una nueva pila vacía y la devuelve.
  * 
- * @param len valor que indica cuantos elementos se pueden guardar en la pila
+ * @param len valor que indica cuantos elementos se pueden guardar en la pila antes de crecer
  * @return Una nueva pila vacía. Si la creación falla, el estado de la cola es inválido.  
  * @details Esta función inicializa una pila vacía. 
- *          Asigna memoria dinámica a data mediante malloc con un número de elementos igual a len
+ *          Asigna memoria dinámica a data mediante malloc con un número de elementos igual a len.
+ *          Esa capacidad inicial es también el mínimo al que la pila se puede encoger.
  */
 Stack stack_create(int len){
     Stack s;
+
+    if (len < 1) {
+        len = 1;  // Siempre reservamos espacio para al menos un elemento
+    }
     
     // Asignar memoria dinámica para 'data' utilizando malloc
     s.data = (Data*) malloc(len * sizeof(Data));  // Asignamos la memoria para el arreglo 'data'
+    s.top = -1;  // Inicializamos el top a -1 para indicar que está vacía
+#ifdef STACK_STATS
+    s.stats = (StackStats){0};
+#endif
 
     if (s.data == NULL) {
         printf("Error: No se pudo asignar memoria para la pila.\n");
-        s.top = -1;  // Si falla la asignación, la pila no puede contener elementos
+        s.len = 0;  // Si falla la asignación, la pila no puede contener elementos
+        s.min_len = 0;
     } else {
-        s.top = -1;  // Inicializamos el top a -1 para indicar que está vacía
+        s.len = len;
+        s.min_len = len;
+        STACK_STATS_ADD(&s, allocs, 1);
+        STACK_STATS_SET(&s, bytes, len * sizeof(Data));
     }
     
     return s;
 }
 
 /**
- * Inserta un elemento en la parte superior de la pila.
+ * Cambia la capacidad del arreglo de la pila.
  * 
- * @param s Referencia a la pila donde se insertará el elemento.
- * @param d Dato que se insertará en la pila.
- * @details Esta función añade el dato `d` en la parte superior de la pila. Si la pila está llena, 
- *          la función no realiza ninguna operación.
+ * @param s Referencia a la pila que se desea redimensionar.
+ * @param len Nueva capacidad, debe ser mayor que top.
+ * @return `true` si se pudo cambiar la capacidad, `false` si realloc falló.
  */
-void stack_push(Stack* s, Data d){
-    if (s == NULL || s->data == NULL) {
-        return;  // Si la pila o los datos son NULL, no hacemos nada
-    }
-    
-    // Verificamos si la pila está llena
-    if (s->top == MAX_SIZE - 1) {  // Si ya hemos alcanzado el tamaño máximo de la pila
-        printf("La pila está llena, no se puede insertar más elementos.\n");
-        return;
+bool stack_resize(Stack* s, int len){
+    Data *data = (Data*) realloc(s->data, len * sizeof(Data));
+    if (data == NULL) {
+        return false;  // El arreglo original sigue siendo válido
     }
-    
-    // Añadimos el dato en la parte superior de la pila
-    s->top++;
-    s->data[s->top] = d;
+    STACK_STATS_ADD(s, allocs, 1);
+    STACK_STATS_ADD(s, grows, len > s->len);
+    STACK_STATS_SET(s, bytes, len * sizeof(Data));
+    s->data = data;
+    s->len = len;
+    return true;
 }
 
 /**
- * Elimina y devuelve el elemento en la parte superior de la pila.
+ * Inserta varios elementos en la parte superior de la pila con una sola copia.
  * 
- * @param s Referencia a la pila de la cual se eliminará el elemento.
- * @return El dato que estaba en la parte superior de la pila. Si la pila está vacía 
- *         devuelve un valor que indica error (por ejemplo, -1 o un valor predeterminado).
- * @details Esta función elimina el elemento en la parte superior de la pila y lo devuelve.
- *          Si la pila está vacía, no se realiza ninguna operación y se devuelve un valor de error.
+ * @param s Referencia a la pila donde se insertarán los elementos.
+ * @param in Arreglo con los datos a insertar; in[n - 1] queda en el top.
+ * @param n Cantidad de datos en `in`.
+ * @return Cantidad de datos insertados: n, o 0 si no hubo memoria para hacer crecer la pila o
+ *         si top + 1 + n no cabe en un int.
+ * @details Equivale a llamar `stack_push` con in[0], in[1], ..., pero la capacidad se ajusta
+ *          con un solo realloc (duplicándola las veces necesarias) y los datos se copian con
+ *          un solo `memcpy`.
  */
-Data stack_pop(Stack* s){
-    Data error_value = -1;  // Valor de error en caso de que la pila esté vacía
-    if (s == NULL || s->data == NULL || s->top == -1) {
-        return error_value;  // Si la pila es NULL o está vacía, devolvemos el valor de error
+int stack_push_n(Stack* s, const Data* in, int n){
+    if (s == NULL || s->data == NULL || in == NULL || n <= 0) {
+        return 0;
     }
-    
-    // Extraemos el dato que está en la parte superior de la pila
-    Data top = s->data[s->top];
-    s->top--;  // Reducimos el top para eliminar el elemento superior
-    
-    return top;
+
+    if (n > INT_MAX - 1 - s->top) {
+        STACK_STATS_ADD(s, rejected, n);
+        return 0;  // top + 1 + n no cabe en un int
+    }
+    // La capacidad se calcula en size_t y se limita a INT_MAX, para que nunca se desborde
+    size_t need = (size_t)s->top + 1 + (size_t)n;
+    size_t len = (size_t)s->len;
+    while (len < need) {
+        len = len > INT_MAX / 2 ? (size_t)INT_MAX : len * 2;
+    }
+    if (len != (size_t)s->len && !stack_resize(s, (int)len)) {
+        STACK_STATS_ADD(s, rejected, n);
+        return 0;
+    }
+
+    memcpy(&s->data[s->top + 1], in, n * sizeof(Data));
+    s->top += n;
+    STACK_STATS_PUSHED(s, n);
+    return n;
 }
 
 /**
- * Verifica si la pila está vacía.
+ * Extrae varios elementos de la parte superior de la pila con una sola copia.
  * 
- * @param s Referencia a la pila que se desea verificar.
- * @return 1 si la pila está vacía, 0 si no lo está. Si el puntero `s` es NULL, devuelve -1.
- * @details Esta función comprueba si la pila no contiene elementos. Es útil para evitar operaciones
- *          como `stack_pop` en una pila vacía.
+ * @param s Referencia a la pila de la cual se extraerán los elementos.
+ * @param out Arreglo donde se guardan los datos extraídos.
+ * @param n Cantidad máxima de datos a extraer.
+ * @return Cantidad de datos extraídos, menor que n si la pila se vació.
+ * @details Los datos quedan en `out` en el orden en que se insertaron: out[count - 1] es el que
+ *          estaba en el top. Así `stack_pop_n` deshace exactamente un `stack_push_n`. Al final
+ *          se aplica la misma regla de encogimiento que en `stack_pop`, con un solo realloc.
  */
-int stack_is_empty(Stack* s){
-    if (s == NULL || s->data == NULL) {
-        return -1;  // Si la pila o los datos son NULL, devolvemos -1
+int stack_pop_n(Stack* s, Data* out, int n){
+    if (s == NULL || s->data == NULL || out == NULL || n <= 0) {
+        return 0;
     }
-    
-    return s->top == -1 ? 1 : 0;  // Si el top es -1, la pila está vacía
+
+    int count = n < s->top + 1 ? n : s->top + 1;
+    s->top -= count;
+    memcpy(out, &s->data[s->top + 1], count * sizeof(Data));
+    STACK_STATS_POPPED(s, count);
+
+    int len = s->len;
+    while (len > s->min_len && s->top + 1 <= len / 4) {
+        len /= 2;
+    }
+    if (len < s->min_len) {
+        len = s->min_len;
+    }
+    if (len != s->len) {
+        stack_resize(s, len);
+    }
+    return count;
 }
 
 /**
@@ -99,6 +151,7 @@ void stack_empty(Stack* s){
         return;  // Si la pila o los datos son NULL, no hacemos nada
     }
     
+    STACK_STATS_POPPED(s, s->top + 1);
     s->top = -1;  // Vaciamos la pila
 }
 
@@ -114,7 +167,11 @@ void stack_delete(Stack* s){
     }
     
     free(s->data);  // Liberamos la memoria dinámica de 'data'
+    STACK_STATS_POPPED(s, s->top + 1);
+    STACK_STATS_SET(s, bytes, 0);
     s->data = NULL;  // Ponemos el puntero a NULL para evitar accesos futuros incorrectos
+    s->top = -1;
+    s->len = 0;
 }
 
 /**
@@ -132,9 +189,25 @@ void stack_print(Stack* s){
         return;
     }
     
-    // Imprimimos los elementos de la pila desde el top hacia abajo
-    for (int i = s->top; i >= 0; i--) {
-        printf("%d ", s->data[i]);
+    // Los datos se escriben con stack_write_text en bloques grandes y no con un printf por
+    // dato; lo que stdio tenga pendiente sale antes para conservar el orden de la salida
+    fflush(stdout);
+    stack_write_text(s, fileno(stdout));
+}
+
+#ifdef STACK_STATS
+/**
+ * Devuelve una copia de las estadísticas de uso de la pila.
+ * 
+ * @param s Referencia a la pila.
+ * @return Los contadores acumulados desde `stack_create`; todos en 0 si `s` es NULL.
+ * @details Solo existe al compilar con -DSTACK_STATS. La cantidad actual de elementos es
+ *          pushes - pops, y bytes / sizeof(Data) es la capacidad actual.
+ */
+StackStats stack_stats(const Stack* s){
+    if (s == NULL) {
+        return (StackStats){0};
     }
-    printf("\n");
+    return s->stats;
 }
+#endif
@@ -1,23 +1,94 @@
 #ifndef __STACK_H__
 #define __STACK_H__
 #include <stdbool.h>
-
-// Definimos el tamaño máximo de la pila
-#define MAX_SIZE 100  // Puedes cambiar este valor si necesitas un tamaño diferente
+#include <stddef.h>
 
 typedef int Data;
 
+// Estadísticas de uso: al compilar con -DSTACK_STATS cada pila lleva estos contadores y
+// `stack_stats` devuelve una copia. Sin la bandera la estructura no cambia y los macros
+// STACK_STATS_* no generan código.
+#ifdef STACK_STATS
+typedef struct {
+    unsigned long pushes;      // Elementos insertados
+    unsigned long pops;        // Elementos que salieron de la pila (pop o vaciado)
+    unsigned long rejected;    // Inserciones descartadas porque no hubo memoria para crecer
+    unsigned long grows;       // Veces que creció la capacidad
+    unsigned long allocs;      // Llamadas exitosas a malloc/realloc (crecer o encoger)
+    size_t bytes;              // Bytes reservados actualmente para el arreglo de datos
+    unsigned long high_water;  // Máximo de elementos guardados a la vez
+} StackStats;
+
+#define STACK_STATS_ADD(s, field, n) ((s)->stats.field += (n))
+#define STACK_STATS_SET(s, field, v) ((s)->stats.field = (v))
+#define STACK_STATS_PUSHED(s, n) stack_stats_pushed(&(s)->stats, (n))
+#define STACK_STATS_POPPED(s, n) ((s)->stats.pops += (n))
+
+// Cuenta n inserciones y actualiza el máximo de elementos (pushes - pops)
+static inline void stack_stats_pushed(StackStats* st, unsigned long n) {
+    st->pushes += n;
+    if (st->pushes - st->pops > st->high_water) {
+        st->high_water = st->pushes - st->pops;
+    }
+}
+#else
+#define STACK_STATS_ADD(s, field, n) ((void)0)
+#define STACK_STATS_SET(s, field, v) ((void)0)
+#define STACK_STATS_PUSHED(s, n) ((void)0)
+#define STACK_STATS_POPPED(s, n) ((void)0)
+#endif
+
 typedef struct {
     Data *data;
     int top;
+    int len;      // Capacidad actual del arreglo data
+    int min_len;  // Capacidad inicial; la pila nunca se encoge por debajo de ella
+#ifdef STACK_STATS
+    StackStats stats;
+#endif
 } Stack;
 
 Stack stack_create(int);
-void stack_push(Stack*, Data);
-Data stack_pop(Stack*);
-bool stack_is_empty(Stack*);
+bool stack_resize(Stack*, int);
+int stack_push_n(Stack*, const Data*, int);
+int stack_pop_n(Stack*, Data*, int);
 void stack_delete(Stack *);
 void stack_empty(Stack*);
 void stack_print(Stack *);
+#ifdef STACK_STATS
+StackStats stack_stats(const Stack*);
+#endif
+
+// Exportación e importación en bloque (stack_io.c), a un buffer o a un descriptor. El formato
+// binario son los datos en crudo de la base al top; el de texto es el de stack_print.
+size_t stack_export_bin(const Stack*, void*, size_t);
+bool stack_write_bin(const Stack*, int);
+int stack_import_bin(Stack*, const void*, size_t);
+int stack_read_bin(Stack*, int);
+size_t stack_export_text(const Stack*, char*, size_t);
+bool stack_write_text(const Stack*, int);
+int stack_import_text(Stack*, const char*, size_t);
+
+// Modo sin verificaciones: con -DSTACK_UNCHECKED las comprobaciones defensivas de apuntadores
+// NULL en las operaciones frecuentes se vuelven assert, que solo existen en compilaciones de
+// depuración; con -DNDEBUG además desaparecen del código. Las verificaciones de pila vacía
+// se conservan, porque forman parte del resultado de las funciones.
+#ifdef STACK_UNCHECKED
+#include <assert.h>
+#define STACK_INVALID(p) (assert((p) != NULL), false)
+#else
+#define STACK_INVALID(p) ((p) == NULL)
+#endif
+
+// Operaciones frecuentes: con -DSTACK_HEADER_ONLY se definen como static inline en stack_inline.h
+#ifdef STACK_HEADER_ONLY
+#define STACK_INLINE static inline
+#include "stack_inline.h"
+#else
+void stack_push(Stack*, Data);
+Data stack_pop(Stack*);
+bool stack_try_pop(Stack*, Data*);
+int stack_is_empty(Stack*);
+#endif
 
 #endif // __STACK_H__
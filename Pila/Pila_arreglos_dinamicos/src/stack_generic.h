@@ -0,0 +1,139 @@
+#ifndef __STACK_GENERIC_H__
+#define __STACK_GENERIC_H__
+#include <limits.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Pila genérica sobre un arreglo dinámico, con el mismo comportamiento que stack.c
+ * (crece al doble cuando se llena y se encoge a la mitad al quedar a un cuarto), pero
+ * guardando elementos de cualquier tipo T directamente en el arreglo.
+ *
+ * DEFINE_STACK(name, T) genera el tipo `name` y funciones `static inline`:
+ *   name name##_create(int len);
+ *   bool name##_push(name*, T);
+ *   bool name##_pop(name*, T* out);
+ *   T*   name##_peek(name*);
+ *   int  name##_size(name*);
+ *   bool name##_is_empty(name*);
+ *   void name##_empty(name*);
+ *   void name##_delete(name*);
+ *
+ * Ejemplo:
+ *   typedef struct { long id; int kind; double value; } Message;
+ *   DEFINE_STACK(MessageStack, Message)
+ *   MessageStack s = MessageStack_create(16);
+ */
+
+#ifndef __GENERIC_ALLOC__
+#define __GENERIC_ALLOC__
+// Indica si T necesita una alineación mayor que la que garantiza malloc
+#define GENERIC_OVERALIGNED(T) (_Alignof(T) > _Alignof(max_align_t))
+
+// Cambia el tamaño de un arreglo de T conservando su alineación; devuelve NULL si falla
+#define GENERIC_RESIZE(T, ptr, new_len, copy_len)                                           \
+    (GENERIC_OVERALIGNED(T) ? generic_realloc_aligned((ptr), _Alignof(T),                   \
+                                                      (new_len) * sizeof(T),                \
+                                                      (copy_len) * sizeof(T))               \
+                            : realloc((ptr), (new_len) * sizeof(T)))
+
+/**
+ * realloc para bloques con alineación mayor a la de malloc: reserva con aligned_alloc,
+ * copia los primeros `copy` bytes y libera el bloque anterior.
+ */
+static inline void* generic_realloc_aligned(void* ptr, size_t align, size_t size, size_t copy) {
+    void* block = aligned_alloc(align, size);
+    if (block == NULL) {
+        return NULL;
+    }
+    if (ptr != NULL) {
+        memcpy(block, ptr, copy < size ? copy : size);
+        free(ptr);
+    }
+    return block;
+}
+#endif // __GENERIC_ALLOC__
+
+#define DEFINE_STACK(name, T)                                                               \
+    typedef struct {                                                                        \
+        T* data;                                                                            \
+        int top;                                                                            \
+        int len;                                                                            \
+        int min_len;                                                                        \
+    } name;                                                                                 \
+                                                                                            \
+    static inline name name##_create(int len) {                                             \
+        name s;                                                                             \
+        if (len < 1) {                                                                      \
+            len = 1;                                                                        \
+        }                                                                                   \
+        s.data = (T*)GENERIC_RESIZE(T, NULL, len, 0);                                    \
+        s.top = -1;                                                                         \
+        s.len = s.data == NULL ? 0 : len;                                                   \
+        s.min_len = s.len;                                                                  \
+        return s;                                                                           \
+    }                                                                                       \
+                                                                                            \
+    static inline bool name##_resize(name* s, int len) {                                    \
+        if ((size_t)len > SIZE_MAX / sizeof(T)) {                                           \
+            return false;                                                                   \
+        }                                                                                   \
+        T* data = (T*)GENERIC_RESIZE(T, s->data, len, s->top + 1);                          \
+        if (data == NULL) {                                                                 \
+            return false;                                                                   \
+        }                                                                                   \
+        s->data = data;                                                                     \
+        s->len = len;                                                                       \
+        return true;                                                                        \
+    }                                                                                       \
+                                                                                            \
+    static inline bool name##_push(name* s, T d) {                                          \
+        /* La capacidad se duplica sin pasar de INT_MAX; ya en INT_MAX la pila no crece */  \
+        if (s->top == s->len - 1                                                            \
+            && (s->data == NULL || s->len == INT_MAX                                        \
+                || !name##_resize(s, s->len > INT_MAX / 2 ? INT_MAX : s->len * 2))) {       \
+            return false;                                                                   \
+        }                                                                                   \
+        s->data[++s->top] = d;                                                              \
+        return true;                                                                        \
+    }                                                                                       \
+                                                                                            \
+    static inline bool name##_pop(name* s, T* out) {                                        \
+        if (s->top == -1) {                                                                 \
+            return false;                                                                   \
+        }                                                                                   \
+        *out = s->data[s->top--];                                                           \
+        if (s->len > s->min_len && s->top + 1 <= s->len / 4) {                              \
+            int len = s->len / 2;                                                           \
+            name##_resize(s, len < s->min_len ? s->min_len : len);                          \
+        }                                                                                   \
+        return true;                                                                        \
+    }                                                                                       \
+                                                                                            \
+    static inline T* name##_peek(name* s) {                                                 \
+        return s->top == -1 ? NULL : &s->data[s->top];                                      \
+    }                                                                                       \
+                                                                                            \
+    static inline int name##_size(name* s) {                                                \
+        return s->top + 1;                                                                  \
+    }                                                                                       \
+                                                                                            \
+    static inline bool name##_is_empty(name* s) {                                           \
+        return s->top == -1;                                                                \
+    }                                                                                       \
+                                                                                            \
+    static inline void name##_empty(name* s) {                                              \
+        s->top = -1;                                                                        \
+    }                                                                                       \
+                                                                                            \
+    static inline void name##_delete(name* s) {                                             \
+        free(s->data);                                                                      \
+        s->data = NULL;                                                                     \
+        s->top = -1;                                                                        \
+        s->len = 0;                                                                         \
+    }
+
+#endif // __STACK_GENERIC_H__
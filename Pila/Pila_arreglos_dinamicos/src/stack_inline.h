@@ -0,0 +1,115 @@
+#ifndef __STACK_INLINE_H__
+#define __STACK_INLINE_H__
+#include <limits.h>
+#include <stddef.h>
+#include <stdio.h>
+
+// Operaciones frecuentes de la pila. Este archivo no se incluye directamente:
+// stack.h lo incluye con STACK_INLINE = static inline cuando se compila con -DSTACK_HEADER_ONLY,
+// para que el compilador pueda integrarlas en el código que las llama, y stack.c lo incluye
+// con STACK_INLINE vacío para generar las versiones normales.
+
+/**
+ * Verifica si la pila está vacía.
+ * 
+ * @param s Referencia a la pila que se desea verificar.
+ * @return 1 si la pila está vacía, 0 si no lo está. Si el puntero `s` es NULL, devuelve -1.
+ * @details Esta función comprueba si la pila no contiene elementos. Es útil para evitar operaciones
+ *          como `stack_pop` en una pila vacía.
+ */
+STACK_INLINE int stack_is_empty(Stack* s){
+    if (STACK_INVALID(s) || STACK_INVALID(s->data)) {
+        return -1;  // Si la pila o los datos son NULL, devolvemos -1
+    }
+    
+    return s->top == -1 ? 1 : 0;  // Si el top es -1, la pila está vacía
+}
+
+/**
+ * Inserta un elemento en la parte superior de la pila.
+ * 
+ * @param s Referencia a la pila donde se insertará el elemento.
+ * @param d Dato que se insertará en la pila.
+ * @details Esta función añade el dato `d` en la parte superior de la pila. Si la pila está llena 
+ *          se duplica su capacidad (hasta INT_MAX); solo si no hay memoria o la capacidad ya es
+ *          INT_MAX la función no realiza ninguna operación.
+ */
+STACK_INLINE void stack_push(Stack* s, Data d){
+    if (STACK_INVALID(s) || STACK_INVALID(s->data)) {
+        return;  // Si la pila o los datos son NULL, no hacemos nada
+    }
+    
+    // Si la pila está llena duplicamos su capacidad, sin pasar de INT_MAX
+    if (s->top == s->len - 1
+        && (s->len == INT_MAX || !stack_resize(s, s->len > INT_MAX / 2 ? INT_MAX : s->len * 2))) {
+        printf("La pila está llena, no se puede insertar más elementos.\n");
+        STACK_STATS_ADD(s, rejected, 1);
+        return;
+    }
+    
+    // Añadimos el dato en la parte superior de la pila
+    s->top++;
+    s->data[s->top] = d;
+    STACK_STATS_PUSHED(s, 1);
+}
+
+/**
+ * Reduce la capacidad a la mitad si la pila quedó a un cuarto de ella, sin bajar de la
+ * capacidad inicial.
+ */
+static inline void stack_shrink(Stack* s){
+    if (s->len > s->min_len && s->top + 1 <= s->len / 4) {
+        int len = s->len / 2;
+        stack_resize(s, len < s->min_len ? s->min_len : len);
+    }
+}
+
+/**
+ * Elimina y devuelve el elemento en la parte superior de la pila.
+ * 
+ * @param s Referencia a la pila de la cual se eliminará el elemento.
+ * @return El dato que estaba en la parte superior de la pila. Si la pila está vacía 
+ *         devuelve un valor que indica error (por ejemplo, -1 o un valor predeterminado).
+ * @details Esta función elimina el elemento en la parte superior de la pila y lo devuelve.
+ *          Si la pila está vacía, no se realiza ninguna operación y se devuelve un valor de error.
+ *          Cuando la pila queda a un cuarto de su capacidad, la capacidad se reduce a la mitad
+ *          (sin bajar de la capacidad inicial). Al crecer al llenarse y encoger solo al cuarto,
+ *          una secuencia de push/pop alrededor del límite no provoca realloc repetidos.
+ */
+STACK_INLINE Data stack_pop(Stack* s){
+    Data error_value = -1;  // Valor de error en caso de que la pila esté vacía
+    if (STACK_INVALID(s) || STACK_INVALID(s->data) || s->top == -1) {
+        return error_value;  // Si la pila es NULL o está vacía, devolvemos el valor de error
+    }
+    
+    // Extraemos el dato que está en la parte superior de la pila
+    Data top = s->data[s->top];
+    s->top--;  // Reducimos el top para eliminar el elemento superior
+    STACK_STATS_POPPED(s, 1);
+    stack_shrink(s);
+    
+    return top;
+}
+
+/**
+ * Intenta extraer el elemento en la parte superior de la pila.
+ * 
+ * @param s Referencia a la pila de la cual se extraerá el elemento.
+ * @param out Donde se guarda el dato extraído.
+ * @return `true` si se extrajo un dato, `false` si la pila está vacía (out no cambia).
+ * @details A diferencia de `stack_pop`, no hay un valor de error que se confunda con un dato,
+ *          así que no hace falta llamar antes a `stack_is_empty`: la pila se revisa una sola vez.
+ *          La capacidad se reduce igual que en `stack_pop`.
+ */
+STACK_INLINE bool stack_try_pop(Stack* s, Data* out){
+    if (STACK_INVALID(s) || STACK_INVALID(out) || s->top == -1) {
+        return false;
+    }
+    *out = s->data[s->top];
+    s->top--;
+    STACK_STATS_POPPED(s, 1);
+    stack_shrink(s);
+    return true;
+}
+
+#endif // __STACK_INLINE_H__
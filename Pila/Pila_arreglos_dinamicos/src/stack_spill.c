@@ -0,0 +1,156 @@
+#define _POSIX_C_SOURCE 200112L  // fileno, posix_fadvise
+#include "stack_spill.h"
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * Crea una pila vacía que guarda en memoria a lo más budget_bytes de datos.
+ *
+ * @param budget_bytes Memoria máxima para los datos en memoria; se usan al menos 2 elementos.
+ * @return Una nueva pila vacía. Si la creación falla, hot.data es NULL.
+ */
+StackSpill stack_spill_create(size_t budget_bytes){
+    StackSpill s;
+    size_t budget = budget_bytes / sizeof(Data);
+
+    s.budget = budget < 2 ? 2 : (budget > 1 << 30 ? 1 << 30 : (int)budget);
+    s.segment = s.budget / 2;
+    s.hot = stack_create(s.budget);  // min_len = budget: nunca crece ni se encoge
+    s.segments = NULL;
+    s.n_segments = 0;
+    s.cap_segments = 0;
+    return s;
+}
+
+/**
+ * Escribe los `segment` elementos más viejos de la memoria en un segmento nuevo.
+ *
+ * @param s Referencia a la pila, con hot lleno.
+ * @return `true` si el segmento se escribió, `false` si no se pudo crear o escribir el archivo.
+ * @details Los elementos que quedan se recorren al inicio del arreglo con un `memmove`, así que
+ *          el costo es O(budget) una vez cada `segment` inserciones, O(1) amortizado.
+ */
+static bool stack_spill_out(StackSpill* s){
+    if (s->n_segments == s->cap_segments) {
+        int cap = s->cap_segments == 0 ? 8 : s->cap_segments * 2;
+        FILE **segments = (FILE**) realloc(s->segments, cap * sizeof(FILE*));
+        if (segments == NULL) {
+            return false;
+        }
+        s->segments = segments;
+        s->cap_segments = cap;
+    }
+
+    FILE *f = tmpfile();  // El sistema borra el archivo al cerrarlo
+    if (f == NULL) {
+        return false;
+    }
+    if (fwrite(s->hot.data, sizeof(Data), s->segment, f) != (size_t)s->segment || fflush(f) != 0) {
+        fclose(f);
+        return false;
+    }
+
+    int keep = s->hot.top + 1 - s->segment;
+    memmove(s->hot.data, s->hot.data + s->segment, keep * sizeof(Data));
+    s->hot.top = keep - 1;
+    s->segments[s->n_segments++] = f;
+    return true;
+}
+
+/**
+ * Lee el segmento más reciente de vuelta debajo de los elementos en memoria.
+ *
+ * @param s Referencia a la pila; hot debe tener espacio para `segment` elementos más.
+ * @details Después de leerlo se le pide al sistema (posix_fadvise) que empiece a traer a
+ *          caché el siguiente segmento, para que su lectura no espere al disco.
+ *          Si la lectura falla el segmento se conserva y se reintenta en el siguiente pop.
+ */
+static void stack_spill_in(StackSpill* s){
+    FILE *f = s->segments[s->n_segments - 1];
+    int size = s->hot.top + 1;
+
+    memmove(s->hot.data + s->segment, s->hot.data, size * sizeof(Data));
+    rewind(f);
+    if (fread(s->hot.data, sizeof(Data), s->segment, f) != (size_t)s->segment) {
+        memmove(s->hot.data, s->hot.data + s->segment, size * sizeof(Data));
+        return;
+    }
+    fclose(f);
+    s->n_segments--;
+    s->hot.top += s->segment;
+
+    if (s->n_segments > 0) {
+        posix_fadvise(fileno(s->segments[s->n_segments - 1]), 0, 0, POSIX_FADV_WILLNEED);
+    }
+}
+
+/**
+ * Inserta un elemento en la parte superior de la pila.
+ *
+ * @param s Referencia a la pila.
+ * @param d Dato que se insertará.
+ * @return `true` si se insertó, `false` si la memoria está llena y no se pudo escribir el segmento.
+ */
+bool stack_spill_push(StackSpill* s, Data d){
+    if (s == NULL || s->hot.data == NULL) {
+        return false;
+    }
+    if (s->hot.top + 1 == s->budget && !stack_spill_out(s)) {
+        return false;
+    }
+    stack_push(&s->hot, d);
+    return true;
+}
+
+/**
+ * Elimina y devuelve el elemento en la parte superior de la pila.
+ *
+ * @param s Referencia a la pila.
+ * @return El dato del top, o -1 si la pila está vacía.
+ * @details Cuando la memoria baja a un cuarto del presupuesto y hay segmentos en disco, se lee
+ *          el más reciente, de modo que el top casi nunca espera a una lectura.
+ */
+Data stack_spill_pop(StackSpill* s){
+    if (s == NULL || s->hot.data == NULL) {
+        return -1;
+    }
+    if (s->n_segments > 0 && s->hot.top + 1 <= s->budget / 4) {
+        stack_spill_in(s);
+    }
+    return stack_pop(&s->hot);
+}
+
+/**
+ * Verifica si la pila está vacía, contando los segmentos en disco.
+ */
+bool stack_spill_is_empty(StackSpill* s){
+    return s == NULL || (s->hot.top == -1 && s->n_segments == 0);
+}
+
+/**
+ * Devuelve la cantidad total de elementos, en memoria y en disco.
+ */
+long stack_spill_size(StackSpill* s){
+    if (s == NULL) {
+        return 0;
+    }
+    return (long)s->n_segments * s->segment + s->hot.top + 1;
+}
+
+/**
+ * Elimina la pila: libera la memoria y cierra (y así borra) los segmentos en disco.
+ */
+void stack_spill_delete(StackSpill* s){
+    if (s == NULL) {
+        return;
+    }
+    for (int i = 0; i < s->n_segments; i++) {
+        fclose(s->segments[i]);
+    }
+    free(s->segments);
+    s->segments = NULL;
+    s->n_segments = 0;
+    s->cap_segments = 0;
+    stack_delete(&s->hot);
+}
@@ -0,0 +1,36 @@
+#ifndef __STACK_SPILL_H__
+#define __STACK_SPILL_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include "stack.h"
+
+/*
+ * Pila con presupuesto de memoria. Guarda en memoria a lo más `budget` elementos (una Stack
+ * normal, la parte "caliente" junto al top). Cuando se llena, la mitad inferior se escribe
+ * de una sola vez en un archivo temporal (un segmento) y se saca de memoria. Los segmentos
+ * forman a su vez una pila: cuando la parte en memoria baja a un cuarto del presupuesto, el
+ * segmento más reciente se lee de vuelta debajo de ella, antes de que el top se agote.
+ *
+ * Push y pop siguen operando sobre el arreglo en memoria; solo una de cada budget/2
+ * operaciones escribe o lee un segmento completo con E/S secuencial.
+ */
+
+typedef struct {
+    Stack hot;          // Elementos en memoria, los más cercanos al top
+    int budget;         // Máximo de elementos en memoria
+    int segment;        // Elementos por segmento en disco (budget / 2)
+    FILE **segments;    // Segmentos en disco; el último está justo debajo de hot
+    int n_segments;
+    int cap_segments;
+} StackSpill;
+
+StackSpill stack_spill_create(size_t budget_bytes);
+bool stack_spill_push(StackSpill*, Data);
+Data stack_spill_pop(StackSpill*);
+bool stack_spill_is_empty(StackSpill*);
+long stack_spill_size(StackSpill*);
+void stack_spill_delete(StackSpill*);
+
+#endif // __STACK_SPILL_H__
@@ -0,0 +1,182 @@
+#include "stack_ws.h"
+#include <stdlib.h>
+
+/**
+ * Reserva un arreglo circular con capacidad para len elementos.
+ *
+ * @return El arreglo, o NULL si no hubo memoria.
+ */
+static StackWSArray* stack_ws_array_new(long len){
+    StackWSArray *a = (StackWSArray*) malloc(sizeof(StackWSArray) + len * sizeof(_Atomic Data));
+    if (a == NULL) {
+        return NULL;
+    }
+    a->len = len;
+    a->prev = NULL;
+    return a;
+}
+
+/**
+ * Crea una nueva pila de robo de trabajo vacía.
+ *
+ * @return Un apuntador a la pila creada, alineado a CACHE_LINE. Si la creación falla, devuelve NULL.
+ */
+StackWS* stack_ws_create(void){
+    StackWS *s = (StackWS*) aligned_alloc(CACHE_LINE, sizeof(StackWS));
+    if (s == NULL) {
+        return NULL;
+    }
+    StackWSArray *a = stack_ws_array_new(STACK_WS_MIN_LEN);
+    if (a == NULL) {
+        free(s);
+        return NULL;
+    }
+    atomic_init(&s->top, 0);
+    atomic_init(&s->bottom, 0);
+    atomic_init(&s->array, a);
+    return s;
+}
+
+/**
+ * Duplica la capacidad del arreglo circular. Solo la llama el dueño, desde push.
+ *
+ * @param s Apuntador a la pila.
+ * @param a Arreglo actual.
+ * @param bottom Índice del elemento más viejo.
+ * @param top Índice siguiente al más nuevo.
+ * @return El nuevo arreglo, o NULL si no hubo memoria (la pila no cambia).
+ * @details Los elementos conservan su índice; solo cambia la máscara con que se ubican. El
+ *          arreglo nuevo se publica con un store release, de modo que un ladrón que lo lea
+ *          también ve los datos copiados.
+ */
+static StackWSArray* stack_ws_grow(StackWS* s, StackWSArray* a, long bottom, long top){
+    StackWSArray *grown = stack_ws_array_new(a->len * 2);
+    if (grown == NULL) {
+        return NULL;
+    }
+    for (long i = bottom; i < top; i++) {
+        Data d = atomic_load_explicit(&a->data[i & (a->len - 1)], memory_order_relaxed);
+        atomic_store_explicit(&grown->data[i & (grown->len - 1)], d, memory_order_relaxed);
+    }
+    grown->prev = a;
+    atomic_store_explicit(&s->array, grown, memory_order_release);
+    return grown;
+}
+
+/**
+ * Inserta un elemento en el top. Solo debe llamarla el hilo dueño.
+ *
+ * @param s Apuntador a la pila.
+ * @param d Dato que se insertará.
+ * @return `true` si se insertó, `false` si el arreglo estaba lleno y no hubo memoria para crecer.
+ * @details El dato se escribe en su casilla y después se publica avanzando top con una
+ *          barrera release; no hay ninguna operación CAS.
+ */
+bool stack_ws_push(StackWS* s, Data d){
+    long top = atomic_load_explicit(&s->top, memory_order_relaxed);
+    long bottom = atomic_load_explicit(&s->bottom, memory_order_acquire);
+    StackWSArray *a = atomic_load_explicit(&s->array, memory_order_relaxed);
+
+    if (top - bottom > a->len - 1) {
+        a = stack_ws_grow(s, a, bottom, top);
+        if (a == NULL) {
+            return false;
+        }
+    }
+    atomic_store_explicit(&a->data[top & (a->len - 1)], d, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&s->top, top + 1, memory_order_relaxed);
+    return true;
+}
+
+/**
+ * Extrae el elemento del top. Solo debe llamarla el hilo dueño.
+ *
+ * @param s Apuntador a la pila.
+ * @param out Donde se guarda el dato extraído.
+ * @return `true` si se extrajo un dato, `false` si la pila estaba vacía (o un ladrón se llevó
+ *         el último elemento); en ese caso out no cambia.
+ * @details El dueño reserva el elemento retrocediendo top y después lee bottom; la barrera
+ *          seq_cst entre ambos garantiza que un ladrón concurrente vea el nuevo top o que el
+ *          dueño vea su avance de bottom. Solo cuando queda un elemento hay que desempatar
+ *          con un CAS sobre bottom.
+ */
+bool stack_ws_pop(StackWS* s, Data* out){
+    long top = atomic_load_explicit(&s->top, memory_order_relaxed) - 1;
+    StackWSArray *a = atomic_load_explicit(&s->array, memory_order_relaxed);
+    atomic_store_explicit(&s->top, top, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    long bottom = atomic_load_explicit(&s->bottom, memory_order_relaxed);
+
+    if (bottom > top) {
+        // Estaba vacía: restauramos top
+        atomic_store_explicit(&s->top, top + 1, memory_order_relaxed);
+        return false;
+    }
+
+    bool ok = true;
+    Data d = atomic_load_explicit(&a->data[top & (a->len - 1)], memory_order_relaxed);
+    if (bottom == top) {
+        // Último elemento: competimos con los ladrones por él
+        ok = atomic_compare_exchange_strong_explicit(&s->bottom, &bottom, bottom + 1,
+                                                     memory_order_seq_cst, memory_order_relaxed);
+        atomic_store_explicit(&s->top, top + 1, memory_order_relaxed);
+    }
+    if (ok) {
+        *out = d;  // Si un ladrón ganó el último elemento, out no cambia
+    }
+    return ok;
+}
+
+/**
+ * Intenta robar el elemento más viejo. La puede llamar cualquier hilo.
+ *
+ * @param s Apuntador a la pila.
+ * @param out Donde se guarda el dato robado.
+ * @return STACK_WS_OK si robó un dato, STACK_WS_EMPTY si la pila estaba vacía o STACK_WS_ABORT
+ *         si otro hilo tomó el elemento primero.
+ */
+StackWSResult stack_ws_steal(StackWS* s, Data* out){
+    long bottom = atomic_load_explicit(&s->bottom, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    long top = atomic_load_explicit(&s->top, memory_order_acquire);
+
+    if (bottom >= top) {
+        return STACK_WS_EMPTY;
+    }
+    StackWSArray *a = atomic_load_explicit(&s->array, memory_order_acquire);
+    Data d = atomic_load_explicit(&a->data[bottom & (a->len - 1)], memory_order_relaxed);
+    if (!atomic_compare_exchange_strong_explicit(&s->bottom, &bottom, bottom + 1,
+                                                 memory_order_seq_cst, memory_order_relaxed)) {
+        return STACK_WS_ABORT;
+    }
+    *out = d;
+    return STACK_WS_OK;
+}
+
+/**
+ * Devuelve una estimación de la cantidad de elementos; exacta si ningún hilo la está modificando.
+ */
+long stack_ws_size(StackWS* s){
+    long bottom = atomic_load_explicit(&s->bottom, memory_order_relaxed);
+    long top = atomic_load_explicit(&s->top, memory_order_relaxed);
+    return top > bottom ? top - bottom : 0;
+}
+
+/**
+ * Elimina la pila y todos sus arreglos, incluidos los que quedaron de crecimientos anteriores.
+ *
+ * @param s Apuntador a la pila. Ningún hilo debe estar usándola.
+ */
+void stack_ws_delete(StackWS* s){
+    if (s == NULL) {
+        return;
+    }
+    StackWSArray *a = atomic_load_explicit(&s->array, memory_order_relaxed);
+    while (a != NULL) {
+        StackWSArray *prev = a->prev;
+        free(a);
+        a = prev;
+    }
+    free(s);
+}
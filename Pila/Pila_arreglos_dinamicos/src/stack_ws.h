@@ -0,0 +1,47 @@
+#ifndef __STACK_WS_H__
+#define __STACK_WS_H__
+#include <stdatomic.h>
+#include <stdbool.h>
+#include "stack.h"
+
+#ifndef CACHE_LINE
+#define CACHE_LINE 64  // Tamaño de una línea de caché
+#endif
+
+// Capacidad inicial del arreglo circular; debe ser potencia de dos
+#define STACK_WS_MIN_LEN 64
+
+// Arreglo circular de la pila. Cuando crece, el arreglo viejo no se libera de inmediato porque
+// un ladrón puede estar leyéndolo: se encadena en prev y se libera en stack_ws_delete.
+typedef struct StackWSArray {
+    long len;  // Capacidad, potencia de dos
+    struct StackWSArray* prev;
+    _Atomic Data data[];
+} StackWSArray;
+
+// Pila de robo de trabajo (deque de Chase-Lev, en la versión C11 de Lê et al.).
+// El hilo dueño inserta y extrae por top, en orden LIFO, como en Stack. Los demás hilos roban
+// por bottom, el elemento más viejo. push y pop del dueño solo usan cargas y escrituras
+// atómicas simples; la única operación CAS del dueño ocurre al extraer el último elemento,
+// cuando compite con los ladrones. Los índices solo crecen; la casilla es índice & (len - 1).
+typedef struct {
+    _Alignas(CACHE_LINE) atomic_long top;        // Siguiente posición libre (la escribe el dueño)
+    _Alignas(CACHE_LINE) atomic_long bottom;     // Elemento más viejo (lo avanzan los ladrones)
+    _Alignas(CACHE_LINE) _Atomic(StackWSArray*) array;
+} StackWS;
+
+// Resultado de un intento de robo
+typedef enum {
+    STACK_WS_OK,       // Se robó un dato
+    STACK_WS_EMPTY,    // La pila estaba vacía
+    STACK_WS_ABORT     // Otro hilo tomó el elemento primero; se puede reintentar
+} StackWSResult;
+
+StackWS* stack_ws_create(void);
+bool stack_ws_push(StackWS*, Data);
+bool stack_ws_pop(StackWS*, Data*);
+StackWSResult stack_ws_steal(StackWS*, Data*);
+long stack_ws_size(StackWS*);
+void stack_ws_delete(StackWS*);
+
+#endif // __STACK_WS_H__
@@ -1,5 +1,30 @@
+#define _POSIX_C_SOURCE 200112L  // fileno, lseek, ftruncate
 #include <check.h>
+#include <limits.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
 #include "../src/stack.h"
+#include "../src/stack_generic.h"
+#include "../src/stack_spill.h"
+#include "../src/stack_ws.h"
+
+typedef struct {
+    long id;
+    int kind;
+    double value;
+} Message;
+
+typedef struct {
+    _Alignas(64) int value;
+} AlignedItem;
+
+DEFINE_STACK(MessageStack, Message)
+DEFINE_STACK(AlignedStack, AlignedItem)
 
 START_TEST(test_stack_init) {
     Stack stack=  stack_create(5);
@@ -11,8 +36,7 @@ START_TEST(test_stack_init) {
 END_TEST
 
 START_TEST(test_stack_push_pop) {
-    Stack stack;
-    stack_init(&stack);
+    Stack stack = stack_create(5);
 
     stack_push(&stack, 10);
     stack_push(&stack, 20);
@@ -25,6 +49,307 @@ START_TEST(test_stack_push_pop) {
 }
 END_TEST
 
+START_TEST(test_stack_grow_shrink) {
+    Stack stack = stack_create(2);
+
+    // La pila crece más allá de su capacidad inicial
+    for (int i = 0; i < 1000; i++) {
+        stack_push(&stack, i);
+    }
+    ck_assert_int_ge(stack.len, 1000);
+
+    // Al vaciarse devuelve memoria, sin bajar de la capacidad inicial
+    for (int i = 999; i >= 0; i--) {
+        ck_assert_int_eq(stack_pop(&stack), i);
+    }
+    ck_assert(stack_is_empty(&stack));
+    ck_assert_int_eq(stack.len, 2);
+    stack_delete(&stack);
+}
+END_TEST
+
+#ifdef STACK_STATS
+START_TEST(test_stack_stats) {
+    Stack stack = stack_create(2);
+    Data in[8] = {0};
+
+    for (int i = 0; i < 1000; i++) {
+        stack_push(&stack, i);
+    }
+    StackStats st = stack_stats(&stack);
+    ck_assert_uint_eq(st.pushes, 1000);
+    ck_assert_uint_eq(st.high_water, 1000);
+    ck_assert_uint_eq(st.grows, 9);  // 2 -> 4 -> ... -> 1024
+    ck_assert_uint_eq(st.allocs, 10);
+    ck_assert_uint_eq(st.bytes, 1024 * sizeof(Data));
+
+    // Al encoger se cuentan reservas pero no crecimientos
+    while (!stack_is_empty(&stack)) {
+        stack_pop(&stack);
+    }
+    stack_push_n(&stack, in, 8);
+    st = stack_stats(&stack);
+    ck_assert_uint_eq(st.pops, 1000);
+    ck_assert_uint_eq(st.pushes - st.pops, 8);
+    ck_assert_uint_eq(st.high_water, 1000);
+    ck_assert_uint_gt(st.allocs, st.grows + 1);
+    ck_assert_uint_eq(st.bytes, stack.len * sizeof(Data));
+    ck_assert_uint_eq(st.rejected, 0);
+
+    stack_delete(&stack);
+    st = stack_stats(&stack);
+    ck_assert_uint_eq(st.bytes, 0);
+    ck_assert_uint_eq(st.pushes - st.pops, 0);
+}
+END_TEST
+#endif
+
+START_TEST(test_stack_push_pop_n) {
+    Stack stack = stack_create(4);
+    Data in[500];
+    Data out[500];
+
+    for (int i = 0; i < 500; i++) {
+        in[i] = i;
+    }
+    stack_push(&stack, -1);
+    ck_assert_int_eq(stack_push_n(&stack, in, 500), 500);
+    ck_assert_int_ge(stack.len, 501);
+    ck_assert_int_eq(stack_pop(&stack), 499);
+
+    ck_assert_int_eq(stack_pop_n(&stack, out, 499), 499);
+    for (int i = 0; i < 499; i++) {
+        ck_assert_int_eq(out[i], i);
+    }
+    ck_assert_int_eq(stack.len, 4);
+    ck_assert_int_eq(stack_pop_n(&stack, out, 10), 1);
+    ck_assert_int_eq(out[0], -1);
+    ck_assert(stack_is_empty(&stack));
+
+    // top + 1 + n no cabe en un int: se rechaza sin tocar la pila ni leer `in`
+    stack_push(&stack, 7);
+    ck_assert_int_eq(stack_push_n(&stack, in, INT_MAX), 0);
+    ck_assert_int_eq(stack.len, 4);
+    ck_assert_int_eq(stack_pop(&stack), 7);
+    stack_delete(&stack);
+}
+END_TEST
+
+START_TEST(test_stack_generic) {
+    MessageStack stack = MessageStack_create(2);
+    Message m;
+
+    ck_assert(MessageStack_is_empty(&stack));
+    for (int i = 0; i < 100; i++) {
+        Message in = { i, i % 3, i * 0.5 };
+        ck_assert(MessageStack_push(&stack, in));
+    }
+    ck_assert_int_eq(MessageStack_size(&stack), 100);
+    ck_assert_int_eq(MessageStack_peek(&stack)->id, 99);
+    for (int i = 99; i >= 0; i--) {
+        ck_assert(MessageStack_pop(&stack, &m));
+        ck_assert_int_eq(m.id, i);
+        ck_assert_int_eq(m.kind, i % 3);
+    }
+    ck_assert(!MessageStack_pop(&stack, &m));
+    ck_assert_int_eq(stack.len, 2);
+    MessageStack_delete(&stack);
+
+    // Los tipos con alineación especial conservan su alineación al crecer
+    AlignedStack aligned = AlignedStack_create(1);
+    AlignedItem item = { 7 };
+    for (int i = 0; i < 10; i++) {
+        AlignedStack_push(&aligned, item);
+    }
+    ck_assert_int_eq((uintptr_t)aligned.data % 64, 0);
+    ck_assert_int_eq(AlignedStack_peek(&aligned)->value, 7);
+    AlignedStack_delete(&aligned);
+}
+END_TEST
+
+START_TEST(test_stack_spill) {
+    StackSpill stack = stack_spill_create(16 * sizeof(Data));
+
+    for (int i = 0; i < 1000; i++) {
+        ck_assert(stack_spill_push(&stack, i));
+    }
+    ck_assert_int_eq(stack_spill_size(&stack), 1000);
+    ck_assert_int_le(stack.hot.top + 1, 16);  // Nunca más del presupuesto en memoria
+    ck_assert_int_gt(stack.n_segments, 0);
+
+    // Los elementos vuelven del disco en orden LIFO, también alternando push y pop
+    for (int i = 999; i >= 500; i--) {
+        ck_assert_int_eq(stack_spill_pop(&stack), i);
+    }
+    stack_spill_push(&stack, -5);
+    ck_assert_int_eq(stack_spill_pop(&stack), -5);
+    for (int i = 499; i >= 0; i--) {
+        ck_assert_int_eq(stack_spill_pop(&stack), i);
+    }
+    ck_assert(stack_spill_is_empty(&stack));
+    ck_assert_int_eq(stack.n_segments, 0);
+    stack_spill_delete(&stack);
+}
+END_TEST
+
+#define WS_ITEMS 100000
+#define WS_THIEVES 3
+
+static StackWS* ws_stack;
+static atomic_int ws_taken[WS_ITEMS];
+static atomic_bool ws_done;
+
+// Ladrón: roba hasta que el dueño termina y la pila queda vacía
+static void* ws_thief(void* arg) {
+    (void)arg;
+    Data d;
+    for (;;) {
+        StackWSResult r = stack_ws_steal(ws_stack, &d);
+        if (r == STACK_WS_OK) {
+            atomic_fetch_add(&ws_taken[d], 1);
+        } else if (r == STACK_WS_EMPTY && atomic_load(&ws_done)) {
+            return NULL;
+        } else {
+            sched_yield();
+        }
+    }
+}
+
+START_TEST(test_stack_ws) {
+    StackWS* s = stack_ws_create();
+    Data d;
+
+    // Un solo hilo: el dueño extrae en orden LIFO y los ladrones en orden FIFO, aun tras crecer
+    for (int i = 0; i < 3 * STACK_WS_MIN_LEN; i++) {
+        ck_assert(stack_ws_push(s, i));
+    }
+    ck_assert_int_eq(stack_ws_size(s), 3 * STACK_WS_MIN_LEN);
+    ck_assert(stack_ws_pop(s, &d));
+    ck_assert_int_eq(d, 3 * STACK_WS_MIN_LEN - 1);
+    ck_assert_int_eq(stack_ws_steal(s, &d), STACK_WS_OK);
+    ck_assert_int_eq(d, 0);
+    while (stack_ws_pop(s, &d)) {
+    }
+    ck_assert_int_eq(stack_ws_steal(s, &d), STACK_WS_EMPTY);
+    d = 77;
+    ck_assert(!stack_ws_pop(s, &d));  // Sin dato, out no cambia
+    ck_assert_int_eq(d, 77);
+    stack_ws_delete(s);
+
+    // Concurrente: cada elemento lo toma exactamente un hilo, el dueño o algún ladrón
+    ws_stack = stack_ws_create();
+    atomic_store(&ws_done, false);
+    pthread_t thieves[WS_THIEVES];
+    for (int t = 0; t < WS_THIEVES; t++) {
+        pthread_create(&thieves[t], NULL, ws_thief, NULL);
+    }
+    for (int i = 0; i < WS_ITEMS; i++) {
+        stack_ws_push(ws_stack, i);
+        if (i % 3 == 0 && stack_ws_pop(ws_stack, &d)) {
+            atomic_fetch_add(&ws_taken[d], 1);
+        }
+    }
+    while (stack_ws_pop(ws_stack, &d)) {
+        atomic_fetch_add(&ws_taken[d], 1);
+    }
+    atomic_store(&ws_done, true);
+    for (int t = 0; t < WS_THIEVES; t++) {
+        pthread_join(thieves[t], NULL);
+    }
+    for (int i = 0; i < WS_ITEMS; i++) {
+        ck_assert_int_eq(atomic_load(&ws_taken[i]), 1);
+    }
+    stack_ws_delete(ws_stack);
+}
+END_TEST
+
+START_TEST(test_stack_try_pop) {
+    Stack stack = stack_create(2);
+    Data d = 99;
+
+    ck_assert(!stack_try_pop(&stack, &d));
+    ck_assert_int_eq(d, 99);  // Sin datos, out no cambia
+
+    // -1 es un dato como cualquier otro: try_pop lo distingue de una pila vacía
+    stack_push(&stack, -1);
+    stack_push(&stack, 5);
+    stack_push(&stack, 6);
+    ck_assert(stack_try_pop(&stack, &d));
+    ck_assert_int_eq(d, 6);
+    ck_assert(stack_try_pop(&stack, &d));
+    ck_assert_int_eq(d, 5);
+    ck_assert(stack_try_pop(&stack, &d));
+    ck_assert_int_eq(d, -1);
+    ck_assert(!stack_try_pop(&stack, &d));
+    ck_assert(stack_is_empty(&stack));
+    stack_delete(&stack);
+}
+END_TEST
+
+START_TEST(test_stack_io) {
+    // Más datos que un bloque de E/S (64 KiB), para recorrer varios bloques
+    enum { N = 50000 };
+    Data* in = (Data*) malloc(N * sizeof(Data));
+    for (int i = 0; i < N; i++) {
+        in[i] = i % 7 == 0 ? INT_MIN + i : (i % 2 == 0 ? -i * 40009 : i * 40009);
+    }
+    Stack stack = stack_create(4);
+    ck_assert_int_eq(stack_push_n(&stack, in, N), N);
+
+    // Binario: datos en crudo de la base al top; también desde una posición sin alinear
+    size_t bin_len = stack_export_bin(&stack, NULL, 0);
+    ck_assert_uint_eq(bin_len, N * sizeof(Data));
+    char* bin = (char*) malloc(bin_len + 1);
+    ck_assert_uint_eq(stack_export_bin(&stack, bin + 1, bin_len), bin_len);
+    ck_assert(memcmp(bin + 1, in, bin_len) == 0);
+
+    Stack copy = stack_create(4);
+    ck_assert_int_eq(stack_import_bin(&copy, bin + 1, bin_len), N);
+    ck_assert_int_eq(stack_import_bin(&copy, bin + 1, 3), -1);
+
+    // Texto: el formato de stack_print, igual en el buffer y en el descriptor
+    size_t text_len = stack_export_text(&stack, NULL, 0);
+    char* text = (char*) malloc(text_len);
+    char* written = (char*) malloc(text_len);
+    ck_assert_uint_eq(stack_export_text(&stack, text, text_len), text_len);
+    ck_assert(text[text_len - 1] == '\n');
+
+    FILE* f = tmpfile();
+    ck_assert_ptr_nonnull(f);
+    ck_assert(stack_write_text(&stack, fileno(f)));
+    ck_assert(lseek(fileno(f), 0, SEEK_CUR) == (off_t) text_len);
+    lseek(fileno(f), 0, SEEK_SET);
+    ck_assert(read(fileno(f), written, text_len) == (ssize_t) text_len);
+    ck_assert(memcmp(written, text, text_len) == 0);
+    ck_assert_int_eq(stack_import_text(&copy, text, text_len), N);
+    ck_assert_int_eq(stack_import_text(&copy, "1 -", 3), -1);  // Inválido: la pila no cambia
+
+    // Descriptor en binario: se escribe y se vuelve a leer
+    ck_assert(ftruncate(fileno(f), 0) == 0);
+    lseek(fileno(f), 0, SEEK_SET);
+    ck_assert(stack_write_bin(&stack, fileno(f)));
+    lseek(fileno(f), 0, SEEK_SET);
+    ck_assert_int_eq(stack_read_bin(&copy, fileno(f)), N);
+    fclose(f);
+
+    // copy tiene la pila tres veces; cada stack_pop_n devuelve los datos originales
+    Data* out = (Data*) malloc(N * sizeof(Data));
+    for (int k = 0; k < 3; k++) {
+        ck_assert_int_eq(stack_pop_n(&copy, out, N), N);
+        ck_assert(memcmp(out, in, N * sizeof(Data)) == 0);
+    }
+    ck_assert(stack_is_empty(&copy));
+
+    stack_delete(&stack);
+    stack_delete(&copy);
+    free(in);
+    free(bin);
+    free(text);
+    free(written);
+    free(out);
+}
+END_TEST
+
 Suite* stack_suite(void) {
     Suite* s;
     TCase* tc_core;
@@ -34,6 +359,16 @@ Suite* stack_suite(void) {
     tc_core = tcase_create("Core");
     tcase_add_test(tc_core, test_stack_init);
     tcase_add_test(tc_core, test_stack_push_pop);
+    tcase_add_test(tc_core, test_stack_grow_shrink);
+#ifdef STACK_STATS
+    tcase_add_test(tc_core, test_stack_stats);
+#endif
+    tcase_add_test(tc_core, test_stack_push_pop_n);
+    tcase_add_test(tc_core, test_stack_generic);
+    tcase_add_test(tc_core, test_stack_spill);
+    tcase_add_test(tc_core, test_stack_ws);
+    tcase_add_test(tc_core, test_stack_try_pop);
+    tcase_add_test(tc_core, test_stack_io);
     suite_add_tcase(s, tc_core);
 
     return s;
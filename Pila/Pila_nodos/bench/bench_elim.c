@@ -0,0 +1,101 @@
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../src/stack.h"
+#include "../src/stack_lf.h"
+#include "../src/stack_elim.h"
+
+// Rendimiento con 50% push y 50% pop repartidos al azar, de 1 a 64 hilos.
+// Compara Stack con un mutex global, la pila de Treiber y la pila con arreglo de eliminación.
+// Uso: ./bench_elim [hilos_max]   (por defecto 64)
+
+#define OPS_PER_THREAD 500000
+
+typedef enum { VARIANT_MUTEX, VARIANT_LF, VARIANT_ELIM } Variant;
+
+static Variant variant;
+static Stack* locked_stack;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static StackLF* lf_stack;
+static StackElim* elim_stack;
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void* worker(void* arg) {
+    uint32_t rng = (uint32_t)(uintptr_t)arg * 2654435761u | 1;
+    Data d;
+    for (int i = 0; i < OPS_PER_THREAD; i++) {
+        rng ^= rng << 13;
+        rng ^= rng >> 17;
+        rng ^= rng << 5;
+        bool push = rng & 1;
+        switch (variant) {
+        case VARIANT_MUTEX:
+            pthread_mutex_lock(&lock);
+            if (push) {
+                stack_push(locked_stack, i);
+            } else if (!stack_is_empty(locked_stack)) {
+                stack_pop(locked_stack);
+            }
+            pthread_mutex_unlock(&lock);
+            break;
+        case VARIANT_LF:
+            if (push) {
+                stack_lf_push(lf_stack, i);
+            } else {
+                stack_lf_pop(lf_stack, &d);
+            }
+            break;
+        case VARIANT_ELIM:
+            if (push) {
+                stack_elim_push(elim_stack, i);
+            } else {
+                stack_elim_pop(elim_stack, &d);
+            }
+            break;
+        }
+    }
+    stack_lf_thread_exit();
+    return NULL;
+}
+
+static double run(Variant v, int n) {
+    pthread_t* threads = (pthread_t*)malloc(n * sizeof(pthread_t));
+    variant = v;
+    double start = now();
+    for (intptr_t t = 0; t < n; t++) {
+        pthread_create(&threads[t], NULL, worker, (void*)(t + 1));
+    }
+    for (int t = 0; t < n; t++) {
+        pthread_join(threads[t], NULL);
+    }
+    double elapsed = now() - start;
+    free(threads);
+    return elapsed;
+}
+
+int main(int argc, char** argv) {
+    int max_threads = argc > 1 ? atoi(argv[1]) : 64;
+    const char* names[] = { "mutex", "treiber", "eliminacion" };
+
+    printf("variante,hilos,segundos,ops_por_segundo\n");
+    for (int n = 1; n <= max_threads; n *= 2) {
+        for (Variant v = VARIANT_MUTEX; v <= VARIANT_ELIM; v++) {
+            locked_stack = stack_create();
+            lf_stack = stack_lf_create();
+            elim_stack = stack_elim_create();
+            double elapsed = run(v, n);
+            printf("%s,%d,%.3f,%.0f\n", names[v], n, elapsed, (double)n * OPS_PER_THREAD / elapsed);
+            stack_delete(locked_stack);
+            stack_lf_delete(lf_stack);
+            stack_elim_delete(elim_stack);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,93 @@
+#include "arena.h"
+#include <stdlib.h>
+
+// Bytes que ocupa el encabezado de un bloque, redondeados a ARENA_ALIGN
+#define ARENA_HEADER ((sizeof(ArenaBlock) + ARENA_ALIGN - 1) / ARENA_ALIGN * ARENA_ALIGN)
+
+/**
+ * Inicializa una arena vacía. No reserva memoria hasta la primera llamada a `arena_alloc`.
+ *
+ * @param a Apuntador a la arena, normalmente una variable local del llamante.
+ */
+void arena_init(Arena* a){
+    a->blocks = NULL;
+    a->cur = NULL;
+    a->end = NULL;
+}
+
+/**
+ * Reserva size bytes de la arena.
+ *
+ * @param a Apuntador a la arena.
+ * @param size Cantidad de bytes.
+ * @return Un apuntador alineado a ARENA_ALIGN, o NULL si no hubo memoria.
+ * @details Si no caben en el bloque actual se pide a malloc un bloque nuevo de
+ *          ARENA_BLOCK_SIZE bytes (o de size bytes si es mayor); lo que quedó libre en el
+ *          bloque anterior no se reutiliza.
+ */
+void* arena_alloc(Arena* a, size_t size){
+    if (a == NULL) {
+        return NULL;
+    }
+    size = (size + ARENA_ALIGN - 1) / ARENA_ALIGN * ARENA_ALIGN;
+
+    if (a->cur == NULL || (size_t)(a->end - a->cur) < size) {
+        size_t data = size > ARENA_BLOCK_SIZE ? size : ARENA_BLOCK_SIZE;
+        ArenaBlock* b = (ArenaBlock*) malloc(ARENA_HEADER + data);
+        if (b == NULL) {
+            return NULL;
+        }
+        b->next = a->blocks;
+        b->size = data;
+        a->blocks = b;
+        a->cur = (char*)b + ARENA_HEADER;
+        a->end = a->cur + data;
+    }
+
+    void* p = a->cur;
+    a->cur += size;
+    return p;
+}
+
+/**
+ * Descarta todo lo reservado pero conserva el bloque más reciente para volver a usarlo.
+ *
+ * @param a Apuntador a la arena.
+ * @details Útil para reutilizar la misma arena en la siguiente petición sin volver a llamar
+ *          a malloc. Todos los apuntadores obtenidos de la arena quedan inválidos.
+ */
+void arena_reset(Arena* a){
+    if (a == NULL || a->blocks == NULL) {
+        return;
+    }
+    ArenaBlock* keep = a->blocks;
+    ArenaBlock* b = keep->next;
+    while (b != NULL) {
+        ArenaBlock* next = b->next;
+        free(b);
+        b = next;
+    }
+    keep->next = NULL;
+    a->cur = (char*)keep + ARENA_HEADER;
+    a->end = a->cur + keep->size;
+}
+
+/**
+ * Libera todos los bloques de la arena en O(cantidad de bloques).
+ *
+ * @param a Apuntador a la arena; queda vacía y se puede volver a usar.
+ * @details Todos los apuntadores obtenidos de la arena quedan inválidos, incluidas las pilas,
+ *          colas y nodos creados en ella, que no deben eliminarse por separado.
+ */
+void arena_release(Arena* a){
+    if (a == NULL) {
+        return;
+    }
+    while (a->blocks != NULL) {
+        ArenaBlock* next = a->blocks->next;
+        free(a->blocks);
+        a->blocks = next;
+    }
+    a->cur = NULL;
+    a->end = NULL;
+}
@@ -2,24 +2,57 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+// Bloque de nodos contiguos; los bloques se encadenan para poder liberarlos al final
+typedef struct Slab {
+    struct Slab* next;
+    Node nodes[NODE_SLAB_SIZE];
+} Slab;
+
+static Slab* slabs = NULL;       // Bloques reservados hasta ahora
+static Node* free_nodes = NULL;  // Lista libre intrusiva: los nodos libres se enlazan por su campo next
+
+/**
+ * Reserva un nuevo bloque de nodos y los agrega a la lista libre.
+ * 
+ * @return 1 si se pudo reservar el bloque, 0 si malloc falló.
+ * @details Los nodos se enlazan en orden de dirección para que nodos creados uno tras otro
+ *          queden contiguos en memoria.
+ */
+static int slab_refill(void){
+    Slab* slab = (Slab*) malloc(sizeof(Slab));
+    if (slab == NULL) {
+        return 0;
+    }
+
+    slab->next = slabs;
+    slabs = slab;
+    for (int i = NODE_SLAB_SIZE - 1; i >= 0; i--) {
+        slab->nodes[i].next = free_nodes;
+        free_nodes = &slab->nodes[i];
+    }
+    return 1;
+}
+
 /**
  * Crea un nuevo nodo con los datos proporcionados y lo devuelve.
  * 
  * @param d Dato que se almacenará en el nuevo nodo.
  * @return Un apuntador al nuevo nodo creado. Si la creación falla, devuelve NULL.
- * @details Esta función asigna memoria dinámicamente para un nuevo nodo utilizando `malloc`.
+ * @details El nodo se toma de la lista libre del allocator de bloques; solo cuando la lista está
+ *          vacía se llama a `malloc` para reservar un bloque de NODE_SLAB_SIZE nodos.
  *          Si la asignación de memoria falla, la función devuelve NULL. El nodo creado
  *          tiene sus campos inicializados, y el campo de datos se establece con el valor
- *          proporcionado en el parámetro `d`, el siguiente .
+ *          proporcionado en el parámetro `d`, el siguiente es NULL.
  */
 Node *new_node(Data d){
-    // Asignar memoria dinámicamente para un nuevo nodo
-    Node* new_n = (Node*) malloc(sizeof(Node));
-
-    if (new_n == NULL) {
+    if (free_nodes == NULL && !slab_refill()) {
         return NULL;  // Si no se pudo asignar memoria, devolver NULL
     }
 
+    // Tomamos el primer nodo de la lista libre
+    Node* new_n = free_nodes;
+    free_nodes = new_n->next;
+
     new_n->data = d;  // Establecer el dato proporcionado en el nodo
     new_n->next = NULL;  // El siguiente nodo es NULL, ya que es el último nodo
 
@@ -27,18 +60,53 @@ Node *new_node(Data d){
 }
 
 /**
- * Elimina un nodo y libera la memoria asociada a él.
+ * Crea un nuevo nodo reservado en una arena.
+ * 
+ * @param a Arena de la que se toma la memoria.
+ * @param d Dato que se almacenará en el nuevo nodo.
+ * @return Un apuntador al nuevo nodo, con su siguiente en NULL. Si la creación falla, devuelve NULL.
+ * @details El nodo no pasa por la lista libre: no debe entregarse a `delete_node`, se libera
+ *          junto con todo lo demás al llamar a `arena_release`.
+ */
+Node *new_node_in(Arena* a, Data d){
+    Node* new_n = (Node*) arena_alloc(a, sizeof(Node));
+    if (new_n == NULL) {
+        return NULL;
+    }
+    new_n->data = d;
+    new_n->next = NULL;
+    return new_n;
+}
+
+/**
+ * Elimina un nodo y lo devuelve a la lista libre.
  * 
  * @param n Apuntador al nodo que se desea eliminar.
- * @details Esta función libera la memoria asignada dinámicamente para el nodo utilizando `free`.
- *          Si el apuntador pasado es NULL, la función no realiza ninguna operación.
+ * @details El nodo no se libera con `free`, se recicla en la lista libre para la siguiente
+ *          llamada a `new_node`. Si el apuntador pasado es NULL, la función no realiza ninguna operación.
  *          Es responsabilidad del llamante asegurarse de que el nodo ya no se utiliza después
- *          de ser eliminado. Está función solo libera nodos cuyo enlace al siguiente es nulo
+ *          de ser eliminado.
  */
 void delete_node(Node* n){
     if (n != NULL) {
-        free(n);  // Liberar la memoria del nodo
+        n->next = free_nodes;  // Reciclar el nodo en la lista libre
+        free_nodes = n;
+    }
+}
+
+/**
+ * Libera todos los bloques reservados por el allocator de nodos.
+ * 
+ * @details Solo debe llamarse cuando ya no queda ningún nodo en uso (por ejemplo, al terminar
+ *          el programa), porque invalida todos los nodos creados con `new_node`.
+ */
+void node_pool_release(void){
+    while (slabs != NULL) {
+        Slab* next = slabs->next;
+        free(slabs);
+        slabs = next;
     }
+    free_nodes = NULL;
 }
 
 /**
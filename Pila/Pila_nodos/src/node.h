@@ -1,5 +1,9 @@
 #ifndef __NODE_H__
 #define __NODE_H__
+#include "arena.h"
+
+// Cantidad de nodos que se reservan juntos en cada bloque (slab)
+#define NODE_SLAB_SIZE 256
 
 typedef int Data;
 typedef struct Node {
@@ -8,7 +12,9 @@ typedef struct Node {
 } Node;
 
 Node *new_node(Data);
+Node *new_node_in(Arena*, Data);
 void delete_node(Node*);
 void print_node(Node*);
+void node_pool_release(void);
 
-#endif
\ No newline at end of file
+#endif
@@ -1,28 +1,13 @@
+#define _POSIX_C_SOURCE 200112L  // fileno
 #include "stack.h"
 #include <stdio.h>
 #include <stdlib.h>
 
-/**
- * Crea un nuevo nodo con los datos proporcionados y lo devuelve.
- * 
- * @param d Dato que se almacenará en el nuevo nodo.
- * @return Un apuntador al nuevo nodo creado. Si la creación falla, devuelve NULL.
- * @details Esta función asigna memoria dinámicamente para un nuevo nodo utilizando `malloc`.
- *          Si la asignación de memoria falla, la función devuelve NULL. El nodo creado
- *          tiene sus campos inicializados, y el campo de datos se establece con el valor
- *          proporcionado en el parámetro `d`, el siguiente nodo se inicializa a NULL.
- */
-Node* new_node(Data d) {
-    Node* newNode = (Node*) malloc(sizeof(Node));
-    if (newNode == NULL) {
-        return NULL;  // Si no se puede asignar memoria, devolver NULL
-    }
-
-    newNode->data = d;  // Asignar el dato al nodo
-    newNode->next = NULL;  // Inicializar el siguiente puntero a NULL
-
-    return newNode;  // Devolver el nodo recién creado
-}
+// Versiones normales (no inline) de las operaciones frecuentes
+#ifndef STACK_HEADER_ONLY
+#define STACK_INLINE
+#include "stack_inline.h"
+#endif
 
 /**
  * Crea una nueva pila vacía y la devuelve.
@@ -41,73 +26,113 @@ Stack* stack_create(){
     }
 
     s->top = NULL;  // Inicializar la pila vacía (top es NULL)
+    s->arena = NULL;
+    s->recycled = NULL;
+#ifdef STACK_STATS
+    s->stats = (StackStats){0};
+#endif
 
     return s;
 }
 
 /**
- * Inserta un elemento en la parte superior de la pila.
+ * Crea una nueva pila vacía dentro de una arena.
  * 
- * @param s Apuntador a la pila donde se insertará el elemento.
- * @param d Dato que se insertará en la pila.
- * @details Esta función añade el dato `d` en la parte superior de la pila. Si la pila está llena
- *          o el puntero `s` es NULL, la función no realiza ninguna operación.
+ * @param a Arena de la que se reservan la pila y todos sus nodos.
+ * @return Un apuntador a la nueva pila. Si la creación falla, devuelve NULL.
+ * @details Los push toman memoria de la arena por desplazamiento en lugar de llamar a malloc,
+ *          y los nodos extraídos se reutilizan en los siguientes push de la misma pila.
+ *          `stack_delete` no recorre los nodos: la pila completa se libera en O(1) por
+ *          bloque con `arena_release`, junto con todo lo demás que se haya creado en la arena.
  */
-void stack_push(Stack* s, Data d){
+Stack* stack_create_in(Arena* a){
+    Stack* s = (Stack*) arena_alloc(a, sizeof(Stack));
     if (s == NULL) {
-        return;  // Si la pila es NULL, no hacer nada
+        return NULL;
     }
 
-    // Crear un nuevo nodo para el elemento a insertar
-    Node* newNode = new_node(d);  // Usamos la función new_node para crear un nuevo nodo
+    s->top = NULL;
+    s->arena = a;
+    s->recycled = NULL;
+#ifdef STACK_STATS
+    s->stats = (StackStats){0};
+#endif
 
-    if (newNode == NULL) {
-        return;  // Si no se pudo crear el nodo, no hacer nada
-    }
-
-    // Insertar el nuevo nodo en la parte superior de la pila
-    newNode->next = s->top;  // El siguiente de nuevo nodo será el antiguo top
-    s->top = newNode;  // El nuevo nodo se convierte en el top de la pila
+    return s;
 }
 
 /**
- * Elimina y devuelve el elemento en la parte superior de la pila.
+ * Inserta varios elementos en la parte superior de la pila.
  * 
- * @param s Apuntador a la pila de la cual se eliminará el elemento.
- * @return El dato que estaba en la parte superior de la pila. Si la pila está vacía o el puntero
- *         `s` es NULL, devuelve un valor que indica error (por ejemplo, -1 o un valor predeterminado).
- * @details Esta función elimina el elemento en la parte superior de la pila y lo devuelve.
- *          Si la pila está vacía, no se realiza ninguna operación y se devuelve un valor de error.
+ * @param s Apuntador a la pila donde se insertarán los elementos.
+ * @param in Arreglo con los datos a insertar; in[n - 1] queda en el top.
+ * @param n Cantidad de datos en `in`.
+ * @return Cantidad de datos insertados, menor que n si no se pudieron crear más nodos.
+ * @details Equivale a llamar `stack_push` con in[0], in[1], ..., pero primero arma la cadena
+ *          de nodos aparte y la enlaza a la pila con una sola actualización de top.
  */
-Data stack_pop(Stack* s){
-    if (s == NULL || s->top == NULL) {
-        return -1;  // Si la pila es NULL o está vacía, devolver error (-1)
+int stack_push_n(Stack* s, const Data* in, int n){
+    if (s == NULL || in == NULL || n <= 0) {
+        return 0;
     }
 
-    // Extraer el dato que está en la parte superior de la pila
-    Node* temp = s->top;  // Apuntador al nodo superior
-    Data top_data = temp->data;  // Obtener el dato del nodo superior
-
-    s->top = s->top->next;  // Mover el top al siguiente nodo
-    delete_node(temp);  // Eliminar el nodo superior y liberar la memoria
+    Node* bottom = NULL;  // Primer nodo creado; se enlazará al top actual
+    Node* chain = NULL;   // Último nodo creado; será el nuevo top
+    int count = 0;
+    while (count < n) {
+        Node* newNode = stack_node_new(s, in[count]);
+        if (newNode == NULL) {
+            break;  // Sin memoria: enlazamos lo que alcanzamos a crear
+        }
+        newNode->next = chain;
+        chain = newNode;
+        if (bottom == NULL) {
+            bottom = newNode;
+        }
+        count++;
+    }
 
-    return top_data;  // Devolver el dato extraído
+    if (chain != NULL) {
+        bottom->next = s->top;
+        s->top = chain;
+    }
+    STACK_STATS_ADD(s, allocs, count);
+    STACK_STATS_ADD(s, bytes, count * sizeof(Node));
+    STACK_STATS_ADD(s, rejected, n - count);
+    STACK_STATS_PUSHED(s, count);
+    return count;
 }
 
 /**
- * Verifica si la pila está vacía.
+ * Extrae varios elementos de la parte superior de la pila.
  * 
- * @param s Apuntador a la pila que se desea verificar.
- * @return 1 si la pila está vacía, 0 si no lo está. Si el puntero `s` es NULL, devuelve -1.
- * @details Esta función comprueba si la pila no contiene elementos. Es útil para evitar operaciones
- *          como `stack_pop` en una pila vacía.
+ * @param s Apuntador a la pila de la cual se extraerán los elementos.
+ * @param out Arreglo donde se guardan los datos extraídos.
+ * @param n Cantidad máxima de datos a extraer.
+ * @return Cantidad de datos extraídos, menor que n si la pila se vació.
+ * @details Los datos quedan en `out` en el orden en que se insertaron: out[count - 1] es el que
+ *          estaba en el top. Así `stack_pop_n` deshace exactamente un `stack_push_n`.
  */
-int stack_is_empty(Stack* s){
-    if (s == NULL) {
-        return -1;  // Si la pila es NULL, devolver -1
+int stack_pop_n(Stack* s, Data* out, int n){
+    if (s == NULL || out == NULL || n <= 0) {
+        return 0;
+    }
+
+    // Contamos cuántos nodos hay disponibles para llenar out desde el final
+    int count = 0;
+    for (Node* current = s->top; current != NULL && count < n; current = current->next) {
+        count++;
     }
 
-    return s->top == NULL ? 1 : 0;  // Si top es NULL, la pila está vacía
+    for (int i = count - 1; i >= 0; i--) {
+        Node* temp = s->top;
+        out[i] = temp->data;
+        s->top = temp->next;
+        stack_node_free(s, temp);
+    }
+    STACK_STATS_SUB(s, bytes, count * sizeof(Node));
+    STACK_STATS_POPPED(s, count);
+    return count;
 }
 
 /**
@@ -116,13 +141,38 @@ int stack_is_empty(Stack* s){
  * @param s Apuntador a la pila que se desea vaciar.
  * @details Esta función elimina todos los elementos de la pila, dejándola vacía.
  *          Si el puntero `s` es NULL, la función no realiza ninguna operación.
- *          La memoria de los elementos eliminados se libera adecuadamente.
+ *          La memoria de los elementos eliminados se libera adecuadamente. Si la pila vive en
+ *          una arena sus nodos pasan a la lista de reciclados, para que llenarla y vaciarla
+ *          muchas veces no siga reservando memoria de la arena.
  */
 void stack_empty(Stack* s){
     if (s == NULL) {
         return;  // Si la pila es NULL, no hacer nada
     }
 
+    if (s->arena != NULL) {
+#ifdef STACK_STATS
+        for (Node* current = s->top; current != NULL; current = current->next) {
+            STACK_STATS_SUB(s, bytes, sizeof(Node));
+            STACK_STATS_POPPED(s, 1);
+        }
+#endif
+        // La cadena completa pasa a recycled para los siguientes push: sin recorrerla si no
+        // había nodos reciclados; si los había, se enlazan después de su último nodo
+        if (s->top != NULL && s->recycled != NULL) {
+            Node* last = s->top;
+            while (last->next != NULL) {
+                last = last->next;
+            }
+            last->next = s->recycled;
+        }
+        if (s->top != NULL) {
+            s->recycled = s->top;
+        }
+        s->top = NULL;
+        return;
+    }
+
     // Vaciar la pila eliminando todos los nodos
     while (s->top != NULL) {
         stack_pop(s);  // Eliminar y liberar el nodo superior hasta que la pila esté vacía
@@ -136,11 +186,12 @@ void stack_empty(Stack* s){
  * @details Esta función libera la memoria asignada dinámicamente para la pila y todos sus elementos
  *          utilizando `free`. Si el puntero pasado es NULL, la función no realiza ninguna operación.
  *          Es responsabilidad del llamante asegurarse de que la pila ya no se utiliza después
- *          de ser eliminada.
+ *          de ser eliminada. Una pila creada con `stack_create_in` no se toca: ella y sus
+ *          nodos pertenecen a la arena.
  */
 void stack_delete(Stack *s){
-    if (s == NULL) {
-        return;  // Si la pila es NULL, no hacer nada
+    if (s == NULL || s->arena != NULL) {
+        return;  // Si la pila es NULL o vive en una arena, no hacer nada
     }
 
     stack_empty(s);  // Vaciar la pila eliminando todos los elementos
@@ -163,10 +214,26 @@ void stack_print(Stack *s){
         return;  // Si la pila es NULL o vacía, no imprimir nada
     }
 
-    Node* current = s->top;  // Apuntador al nodo superior
-    while (current != NULL) {
-        printf("%d ", current->data);  // Imprimir el dato del nodo
-        current = current->next;  // Mover al siguiente nodo
+    // Los datos se escriben con stack_write_text en bloques grandes y no con un printf por
+    // dato; lo que stdio tenga pendiente sale antes para conservar el orden de la salida
+    fflush(stdout);
+    stack_write_text(s, fileno(stdout));
+}
+
+#ifdef STACK_STATS
+/**
+ * Devuelve una copia de las estadísticas de uso de la pila.
+ * 
+ * @param s Apuntador a la pila.
+ * @return Los contadores acumulados desde `stack_create`; todos en 0 si `s` es NULL.
+ * @details Solo existe al compilar con -DSTACK_STATS. La cantidad actual de elementos es
+ *          pushes - pops. Los bytes cuentan los nodos de esta pila, no los bloques completos
+ *          que el allocator de nodos tenga reservados.
+ */
+StackStats stack_stats(const Stack* s){
+    if (s == NULL) {
+        return (StackStats){0};
     }
-    printf("\n");
+    return s->stats;
 }
+#endif
@@ -2,18 +2,117 @@
 #define __STACK_H__
 #include "node.h"
 #include <stdbool.h>
+#include <stddef.h>
 
+// Estadísticas de uso: al compilar con -DSTACK_STATS cada pila lleva estos contadores y
+// `stack_stats` devuelve una copia. Sin la bandera la estructura no cambia y los macros
+// STACK_STATS_* no generan código.
+#ifdef STACK_STATS
+typedef struct {
+    unsigned long pushes;      // Elementos insertados
+    unsigned long pops;        // Elementos que salieron de la pila (pop o vaciado)
+    unsigned long rejected;    // Inserciones descartadas porque no se pudo crear el nodo
+    unsigned long grows;       // Siempre 0: la pila crece de nodo en nodo, ver allocs
+    unsigned long allocs;      // Nodos obtenidos con new_node
+    size_t bytes;              // Bytes que ocupan los nodos de la pila
+    unsigned long high_water;  // Máximo de elementos guardados a la vez
+} StackStats;
+
+#define STACK_STATS_ADD(s, field, n) ((s)->stats.field += (n))
+#define STACK_STATS_SUB(s, field, n) ((s)->stats.field -= (n))
+#define STACK_STATS_PUSHED(s, n) stack_stats_pushed(&(s)->stats, (n))
+#define STACK_STATS_POPPED(s, n) ((s)->stats.pops += (n))
+
+// Cuenta n inserciones y actualiza el máximo de elementos (pushes - pops)
+static inline void stack_stats_pushed(StackStats* st, unsigned long n) {
+    st->pushes += n;
+    if (st->pushes - st->pops > st->high_water) {
+        st->high_water = st->pushes - st->pops;
+    }
+}
+#else
+#define STACK_STATS_ADD(s, field, n) ((void)0)
+#define STACK_STATS_SUB(s, field, n) ((void)0)
+#define STACK_STATS_PUSHED(s, n) ((void)0)
+#define STACK_STATS_POPPED(s, n) ((void)0)
+#endif
 
 typedef struct {
     Node* top;
+    Arena* arena;    // Arena de la que salen la pila y sus nodos; NULL si usan malloc y node.c
+    Node* recycled;  // Con arena: nodos ya extraídos, listos para el siguiente push
+#ifdef STACK_STATS
+    StackStats stats;
+#endif
 } Stack;
 
 Stack *stack_create();
-void stack_push(Stack*, Data);
-Data stack_pop(Stack*);
-bool stack_is_empty(Stack* );
+Stack *stack_create_in(Arena*);
+int stack_push_n(Stack*, const Data*, int);
+int stack_pop_n(Stack*, Data*, int);
 void stack_delete(Stack *);
 void stack_empty(Stack*);
 void stack_print(Stack *);
+#ifdef STACK_STATS
+StackStats stack_stats(const Stack*);
+#endif
+
+// Exportación e importación en bloque (stack_io.c), a un buffer o a un descriptor. El formato
+// binario son los datos en crudo de la base al top; el de texto es el de stack_print.
+size_t stack_export_bin(const Stack*, void*, size_t);
+bool stack_write_bin(const Stack*, int);
+int stack_import_bin(Stack*, const void*, size_t);
+int stack_read_bin(Stack*, int);
+size_t stack_export_text(const Stack*, char*, size_t);
+bool stack_write_text(const Stack*, int);
+int stack_import_text(Stack*, const char*, size_t);
+
+// Obtiene un nodo para la pila: de su arena, reutilizando primero los nodos ya extraídos,
+// o del allocator de bloques de node.c si la pila no tiene arena
+static inline Node* stack_node_new(Stack* s, Data d){
+    if (s->arena == NULL) {
+        return new_node(d);
+    }
+    Node* n = s->recycled;
+    if (n == NULL) {
+        return new_node_in(s->arena, d);
+    }
+    s->recycled = n->next;
+    n->data = d;
+    n->next = NULL;
+    return n;
+}
+
+// Devuelve un nodo que salió de la pila a su origen
+static inline void stack_node_free(Stack* s, Node* n){
+    if (s->arena == NULL) {
+        delete_node(n);
+        return;
+    }
+    n->next = s->recycled;
+    s->recycled = n;
+}
+
+// Modo sin verificaciones: con -DSTACK_UNCHECKED las comprobaciones defensivas de apuntadores
+// NULL en las operaciones frecuentes se vuelven assert, que solo existen en compilaciones de
+// depuración; con -DNDEBUG además desaparecen del código. Las verificaciones de pila vacía
+// se conservan, porque forman parte del resultado de las funciones.
+#ifdef STACK_UNCHECKED
+#include <assert.h>
+#define STACK_INVALID(p) (assert((p) != NULL), false)
+#else
+#define STACK_INVALID(p) ((p) == NULL)
+#endif
+
+// Operaciones frecuentes: con -DSTACK_HEADER_ONLY se definen como static inline en stack_inline.h
+#ifdef STACK_HEADER_ONLY
+#define STACK_INLINE static inline
+#include "stack_inline.h"
+#else
+void stack_push(Stack*, Data);
+Data stack_pop(Stack*);
+bool stack_try_pop(Stack*, Data*);
+int stack_is_empty(Stack* );
+#endif
 
 #endif // __STACK_H__
\ No newline at end of file
@@ -0,0 +1,160 @@
+#include "stack_elim.h"
+#include <stdint.h>
+#include <stdlib.h>
+
+// Estados de una casilla; con ELIM_OFFER los 32 bits bajos guardan el dato ofrecido
+#define ELIM_EMPTY 0ULL
+#define ELIM_OFFER (1ULL << 32)
+#define ELIM_TAKEN (2ULL << 32)
+
+_Static_assert(sizeof(Data) <= sizeof(uint32_t), "El dato debe caber en 32 bits para ofrecerse en una casilla");
+
+static _Thread_local uint32_t rng_state = 0;  // Estado del generador para elegir casilla
+
+/**
+ * Elige una casilla al azar del arreglo de eliminación (xorshift por hilo).
+ */
+static StackElimSlot* random_slot(StackElim* s){
+    if (rng_state == 0) {
+        rng_state = (uint32_t)(uintptr_t)&rng_state | 1;  // Semilla distinta por hilo
+    }
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return &s->slots[rng_state % STACK_ELIM_SLOTS];
+}
+
+/**
+ * Ofrece un dato en una casilla y espera a que un pop lo tome.
+ * 
+ * @return `true` si un pop tomó el dato, `false` si nadie llegó y la oferta se retiró.
+ * @details Solo el hilo que hizo la oferta puede devolver la casilla a ELIM_EMPTY, y un pop
+ *          solo puede cambiar ELIM_OFFER por ELIM_TAKEN; así cada oferta se entrega una vez.
+ */
+static bool eliminate_push(StackElim* s, Data d){
+    StackElimSlot* slot = random_slot(s);
+    unsigned long long offer = ELIM_OFFER | (uint32_t)d;
+    unsigned long long expected = ELIM_EMPTY;
+    if (!atomic_compare_exchange_strong(&slot->word, &expected, offer)) {
+        return false;  // La casilla está ocupada
+    }
+    for (int i = 0; i < STACK_ELIM_SPINS; i++) {
+        if (atomic_load_explicit(&slot->word, memory_order_acquire) == ELIM_TAKEN) {
+            atomic_store_explicit(&slot->word, ELIM_EMPTY, memory_order_release);
+            return true;
+        }
+    }
+    expected = offer;
+    if (atomic_compare_exchange_strong(&slot->word, &expected, ELIM_EMPTY)) {
+        return false;  // Nadie tomó la oferta
+    }
+    atomic_store_explicit(&slot->word, ELIM_EMPTY, memory_order_release);  // Un pop la tomó al final
+    return true;
+}
+
+/**
+ * Busca una oferta en una casilla y la toma.
+ * 
+ * @return `true` si se tomó un dato ofrecido por un push, `false` si no apareció ninguno.
+ * @details El dato viaja dentro de la palabra de la casilla, así que aunque la misma casilla
+ *          se reutilice entre la lectura y el CAS, el valor tomado es el de la oferta vigente.
+ */
+static bool eliminate_pop(StackElim* s, Data* out){
+    StackElimSlot* slot = random_slot(s);
+    for (int i = 0; i < STACK_ELIM_SPINS; i++) {
+        unsigned long long word = atomic_load_explicit(&slot->word, memory_order_acquire);
+        if ((word & ~0xFFFFFFFFULL) == ELIM_OFFER) {
+            if (atomic_compare_exchange_strong(&slot->word, &word, ELIM_TAKEN)) {
+                *out = (Data)(uint32_t)word;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/**
+ * Crea una nueva pila con arreglo de eliminación vacía y la devuelve.
+ * 
+ * @return Un apuntador a la nueva pila creada. Si la creación falla, devuelve NULL.
+ */
+StackElim *stack_elim_create(){
+    StackElim* s = (StackElim*) aligned_alloc(64, sizeof(StackElim));
+    if (s == NULL) {
+        return NULL;
+    }
+    s->stack = stack_lf_create();
+    if (s->stack == NULL) {
+        free(s);
+        return NULL;
+    }
+    for (int i = 0; i < STACK_ELIM_SLOTS; i++) {
+        atomic_init(&s->slots[i].word, ELIM_EMPTY);
+    }
+    return s;
+}
+
+/**
+ * Inserta un elemento en la pila. Puede llamarse desde cualquier hilo.
+ * 
+ * @param s Apuntador a la pila donde se insertará el elemento.
+ * @param d Dato que se insertará en la pila.
+ * @return `true` si el dato se insertó o se entregó a un pop, `false` si no hubo memoria.
+ * @details Primero intenta el CAS sobre top; si falla por contención ofrece el dato en el
+ *          arreglo de eliminación, y si nadie lo toma vuelve a intentar sobre top.
+ */
+bool stack_elim_push(StackElim* s, Data d){
+    if (s == NULL) {
+        return false;
+    }
+    StackLFNode* n = stack_lf_new_node(d);
+    if (n == NULL) {
+        return false;
+    }
+    for (;;) {
+        if (stack_lf_try_push(s->stack, n)) {
+            return true;
+        }
+        if (eliminate_push(s, d)) {
+            free(n);  // El dato se entregó directamente, el nodo nunca se publicó
+            return true;
+        }
+    }
+}
+
+/**
+ * Extrae el elemento en la parte superior de la pila. Puede llamarse desde cualquier hilo.
+ * 
+ * @param s Apuntador a la pila de la cual se eliminará el elemento.
+ * @param out Apuntador donde se guarda el dato extraído.
+ * @return `true` si se extrajo un dato, `false` si la pila está vacía o `s` es NULL.
+ * @details Igual que `stack_elim_push`: ante un conflicto sobre top busca una oferta en el
+ *          arreglo de eliminación antes de reintentar.
+ */
+bool stack_elim_pop(StackElim* s, Data* out){
+    if (s == NULL) {
+        return false;
+    }
+    for (;;) {
+        StackLFResult r = stack_lf_try_pop(s->stack, out);
+        if (r != STACK_LF_CONFLICT) {
+            return r == STACK_LF_OK;
+        }
+        if (eliminate_pop(s, out)) {
+            return true;
+        }
+    }
+}
+
+/**
+ * Elimina la pila y libera la memoria asociada a ella.
+ * 
+ * @param s Apuntador a la pila. Ningún hilo debe seguir usándola.
+ */
+void stack_elim_delete(StackElim* s){
+    if (s == NULL) {
+        return;
+    }
+    stack_lf_delete(s->stack);
+    free(s);
+}
@@ -0,0 +1,28 @@
+#ifndef __STACK_ELIM_H__
+#define __STACK_ELIM_H__
+#include <stdatomic.h>
+#include <stdbool.h>
+#include "stack_lf.h"
+
+// Casillas del arreglo de eliminación y cuántas vueltas espera un hilo a su pareja
+#define STACK_ELIM_SLOTS 16
+#define STACK_ELIM_SPINS 256
+
+// Casilla de intercambio: guarda el estado y el dato ofrecido en una sola palabra
+typedef struct {
+    _Alignas(64) atomic_ullong word;
+} StackElimSlot;
+
+// Pila de Treiber con arreglo de eliminación: si el CAS sobre top falla por contención,
+// un push y un pop que coinciden en la misma casilla intercambian el dato sin tocar top.
+typedef struct {
+    StackLF* stack;
+    StackElimSlot slots[STACK_ELIM_SLOTS];
+} StackElim;
+
+StackElim *stack_elim_create();
+bool stack_elim_push(StackElim*, Data);
+bool stack_elim_pop(StackElim*, Data*);
+void stack_elim_delete(StackElim*);
+
+#endif // __STACK_ELIM_H__
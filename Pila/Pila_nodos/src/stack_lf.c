@@ -0,0 +1,250 @@
+#include "stack_lf.h"
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Cantidad de nodos retirados que acumula un hilo antes de intentar liberarlos
+#define STACK_LF_RETIRE_THRESHOLD (2 * STACK_LF_MAX_THREADS)
+
+// Un hazard pointer por hilo, cada uno en su propia línea de caché
+typedef struct {
+    _Alignas(64) _Atomic(StackLFNode*) node;
+    atomic_bool used;
+} HazardSlot;
+
+static HazardSlot hazards[STACK_LF_MAX_THREADS];
+
+static _Thread_local HazardSlot* my_hazard = NULL;     // Hazard pointer del hilo actual
+static _Thread_local StackLFNode* retired = NULL;      // Nodos extraídos pendientes de liberar
+static _Thread_local int retired_count = 0;
+
+/**
+ * Devuelve el hazard pointer del hilo actual, reservando uno libre la primera vez.
+ * 
+ * @details Si ya hay STACK_LF_MAX_THREADS hilos registrados el programa termina, porque sin
+ *          hazard pointer no es posible extraer nodos de forma segura.
+ */
+static HazardSlot* hazard_get(void){
+    if (my_hazard != NULL) {
+        return my_hazard;
+    }
+    for (int i = 0; i < STACK_LF_MAX_THREADS; i++) {
+        bool expected = false;
+        if (atomic_compare_exchange_strong(&hazards[i].used, &expected, true)) {
+            my_hazard = &hazards[i];
+            return my_hazard;
+        }
+    }
+    fprintf(stderr, "Error: más de %d hilos usan pilas concurrentes.\n", STACK_LF_MAX_THREADS);
+    abort();
+}
+
+/**
+ * Libera los nodos retirados por el hilo actual que ningún hazard pointer protege.
+ * 
+ * @details Los nodos protegidos se quedan en la lista de retirados para el siguiente intento.
+ */
+static void retired_scan(void){
+    StackLFNode* protected_nodes[STACK_LF_MAX_THREADS];
+    int n_protected = 0;
+    for (int i = 0; i < STACK_LF_MAX_THREADS; i++) {
+        StackLFNode* p = atomic_load(&hazards[i].node);
+        if (p != NULL) {
+            protected_nodes[n_protected++] = p;
+        }
+    }
+
+    StackLFNode* pending = retired;
+    retired = NULL;
+    retired_count = 0;
+    while (pending != NULL) {
+        StackLFNode* next = pending->retired_next;
+        bool in_use = false;
+        for (int i = 0; i < n_protected && !in_use; i++) {
+            in_use = protected_nodes[i] == pending;
+        }
+        if (in_use) {
+            pending->retired_next = retired;  // Aún hay un hilo leyendo el nodo
+            retired = pending;
+            retired_count++;
+        } else {
+            free(pending);
+        }
+        pending = next;
+    }
+}
+
+/**
+ * Crea una nueva pila concurrente vacía y la devuelve.
+ * 
+ * @return Un apuntador a la nueva pila creada. Si la creación falla, devuelve NULL.
+ */
+StackLF *stack_lf_create(){
+    StackLF* s = (StackLF*) malloc(sizeof(StackLF));
+    if (s == NULL) {
+        return NULL;
+    }
+    atomic_init(&s->top, NULL);
+    return s;
+}
+
+/**
+ * Crea un nodo para la pila concurrente.
+ * 
+ * @param d Dato que se almacenará en el nodo.
+ * @return Un apuntador al nodo creado con `malloc`. Si la creación falla, devuelve NULL.
+ */
+StackLFNode *stack_lf_new_node(Data d){
+    StackLFNode* n = (StackLFNode*) malloc(sizeof(StackLFNode));
+    if (n == NULL) {
+        return NULL;
+    }
+    n->data = d;
+    n->next = NULL;
+    n->retired_next = NULL;
+    return n;
+}
+
+/**
+ * Hace un solo intento de enlazar un nodo en la parte superior de la pila.
+ * 
+ * @param s Apuntador a la pila.
+ * @param n Nodo creado con `stack_lf_new_node`.
+ * @return `true` si el nodo quedó en el top, `false` si otro hilo cambió top durante el intento.
+ */
+bool stack_lf_try_push(StackLF* s, StackLFNode* n){
+    n->next = atomic_load_explicit(&s->top, memory_order_relaxed);
+    return atomic_compare_exchange_strong_explicit(&s->top, &n->next, n,
+                                                   memory_order_release, memory_order_relaxed);
+}
+
+/**
+ * Inserta un elemento en la parte superior de la pila. Puede llamarse desde cualquier hilo.
+ * 
+ * @param s Apuntador a la pila donde se insertará el elemento.
+ * @param d Dato que se insertará en la pila.
+ * @return `true` si el dato se insertó, `false` si `s` es NULL o no hubo memoria para el nodo.
+ * @details El nodo nuevo se enlaza al top actual y se publica con un CAS; si otro hilo cambió
+ *          top entre tanto, se reintenta.
+ */
+bool stack_lf_push(StackLF* s, Data d){
+    if (s == NULL) {
+        return false;
+    }
+    StackLFNode* n = stack_lf_new_node(d);
+    if (n == NULL) {
+        return false;
+    }
+    while (!stack_lf_try_push(s, n)) {
+        // Otro hilo cambió top, reintentamos
+    }
+    return true;
+}
+
+/**
+ * Hace un solo intento de extraer el elemento en la parte superior de la pila.
+ * 
+ * @param s Apuntador a la pila.
+ * @param out Apuntador donde se guarda el dato extraído.
+ * @return STACK_LF_OK si se extrajo un dato, STACK_LF_EMPTY si la pila está vacía o
+ *         STACK_LF_CONFLICT si otro hilo cambió top durante el intento.
+ * @details Antes de leer top->next el hilo publica top en su hazard pointer y comprueba que
+ *          top no cambió. Mientras esté publicado, el nodo no se libera ni se reutiliza, por lo
+ *          que el CAS no puede tener éxito sobre un nodo reciclado (ABA). El nodo extraído se
+ *          retira y se libera más tarde, cuando ningún hazard pointer lo protege.
+ */
+StackLFResult stack_lf_try_pop(StackLF* s, Data* out){
+    HazardSlot* hp = hazard_get();
+    StackLFNode* top = atomic_load_explicit(&s->top, memory_order_acquire);
+    if (top == NULL) {
+        return STACK_LF_EMPTY;
+    }
+    atomic_store(&hp->node, top);
+    if (atomic_load(&s->top) != top) {
+        atomic_store_explicit(&hp->node, NULL, memory_order_release);
+        return STACK_LF_CONFLICT;  // top cambió antes de quedar protegido
+    }
+    StackLFNode* next = top->next;
+    bool ok = atomic_compare_exchange_strong_explicit(&s->top, &top, next,
+                                                      memory_order_acquire, memory_order_relaxed);
+    atomic_store_explicit(&hp->node, NULL, memory_order_release);
+    if (!ok) {
+        return STACK_LF_CONFLICT;
+    }
+
+    *out = top->data;
+    top->retired_next = retired;
+    retired = top;
+    if (++retired_count >= STACK_LF_RETIRE_THRESHOLD) {
+        retired_scan();
+    }
+    return STACK_LF_OK;
+}
+
+/**
+ * Elimina el elemento en la parte superior de la pila. Puede llamarse desde cualquier hilo.
+ * 
+ * @param s Apuntador a la pila de la cual se eliminará el elemento.
+ * @param out Apuntador donde se guarda el dato extraído.
+ * @return `true` si se extrajo un dato, `false` si la pila está vacía o `s` es NULL.
+ * @details Repite `stack_lf_try_pop` mientras haya conflictos con otros hilos.
+ */
+bool stack_lf_pop(StackLF* s, Data* out){
+    if (s == NULL) {
+        return false;
+    }
+    StackLFResult r;
+    while ((r = stack_lf_try_pop(s, out)) == STACK_LF_CONFLICT) {
+        // Otro hilo cambió top, reintentamos
+    }
+    return r == STACK_LF_OK;
+}
+
+/**
+ * Verifica si la pila está vacía.
+ * 
+ * @param s Apuntador a la pila que se desea verificar.
+ * @return `true` si la pila está vacía o `s` es NULL. Con otros hilos activos el resultado
+ *         puede cambiar inmediatamente después.
+ */
+bool stack_lf_is_empty(StackLF* s){
+    return s == NULL || atomic_load(&s->top) == NULL;
+}
+
+/**
+ * Elimina la pila y libera los nodos que aún contiene.
+ * 
+ * @param s Apuntador a la pila. Ningún hilo debe seguir usándola.
+ */
+void stack_lf_delete(StackLF* s){
+    if (s == NULL) {
+        return;
+    }
+    StackLFNode* n = atomic_load(&s->top);
+    while (n != NULL) {
+        StackLFNode* next = n->next;
+        free(n);
+        n = next;
+    }
+    free(s);
+}
+
+/**
+ * Libera los nodos retirados por el hilo actual y su hazard pointer.
+ * 
+ * @details Cada hilo que usó `stack_lf_pop` debe llamarla antes de terminar. Espera a que
+ *          ningún otro hilo proteja los nodos pendientes, lo que solo dura lo que tarda un pop.
+ */
+void stack_lf_thread_exit(void){
+    while (retired != NULL) {
+        retired_scan();
+        if (retired != NULL) {
+            sched_yield();
+        }
+    }
+    if (my_hazard != NULL) {
+        atomic_store(&my_hazard->node, NULL);
+        atomic_store(&my_hazard->used, false);
+        my_hazard = NULL;
+    }
+}
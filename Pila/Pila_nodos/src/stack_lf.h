@@ -0,0 +1,41 @@
+#ifndef __STACK_LF_H__
+#define __STACK_LF_H__
+#include <stdatomic.h>
+#include <stdbool.h>
+#include "node.h"
+
+// Número máximo de hilos que pueden usar pilas concurrentes al mismo tiempo
+#define STACK_LF_MAX_THREADS 128
+
+// Nodo propio de la pila concurrente: se reserva con malloc porque el allocator de node.c
+// no es seguro entre hilos
+typedef struct StackLFNode {
+    Data data;
+    struct StackLFNode* next;
+    struct StackLFNode* retired_next;  // Enlace en la lista de retirados; next no se toca al retirar
+} StackLFNode;
+
+// Pila de Treiber: push y pop hacen CAS sobre top. Los nodos extraídos se liberan con
+// hazard pointers, así ningún hilo lee un nodo ya liberado y no hay problema ABA.
+typedef struct {
+    _Atomic(StackLFNode*) top;
+} StackLF;
+
+// Resultado de un solo intento de extracción
+typedef enum {
+    STACK_LF_OK,        // Se extrajo un dato
+    STACK_LF_EMPTY,     // La pila estaba vacía
+    STACK_LF_CONFLICT   // Otro hilo cambió top; se puede reintentar
+} StackLFResult;
+
+StackLF *stack_lf_create();
+StackLFNode *stack_lf_new_node(Data);
+bool stack_lf_try_push(StackLF*, StackLFNode*);
+StackLFResult stack_lf_try_pop(StackLF*, Data*);
+bool stack_lf_push(StackLF*, Data);
+bool stack_lf_pop(StackLF*, Data*);
+bool stack_lf_is_empty(StackLF*);
+void stack_lf_delete(StackLF*);
+void stack_lf_thread_exit(void);
+
+#endif // __STACK_LF_H__
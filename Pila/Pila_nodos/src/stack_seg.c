@@ -0,0 +1,151 @@
+#include "stack_seg.h"
+#include <stdlib.h>
+
+/**
+ * Crea una nueva pila segmentada vacía.
+ *
+ * @return Un apuntador a la pila creada. Si la creación falla, devuelve NULL.
+ * @details No se reserva ningún segmento hasta el primer `stack_seg_push`.
+ */
+StackSeg* stack_seg_create(){
+    StackSeg* s = (StackSeg*) malloc(sizeof(StackSeg));
+    if (s == NULL) {
+        return NULL;
+    }
+    s->top = NULL;
+    s->used = 0;
+    s->size = 0;
+    s->spare = NULL;
+    return s;
+}
+
+/**
+ * Inserta un elemento en la parte superior de la pila.
+ *
+ * @param s Apuntador a la pila.
+ * @param d Dato que se insertará.
+ * @return `true` si se insertó, `false` si `s` es NULL o no hubo memoria para un segmento nuevo.
+ * @details Si el segmento superior está lleno se enlaza uno nuevo encima, tomando primero el
+ *          segmento guardado en spare; así una secuencia push/pop que oscila en el borde de
+ *          un segmento no llama a malloc ni a free.
+ */
+bool stack_seg_push(StackSeg* s, Data d){
+    if (s == NULL) {
+        return false;
+    }
+
+    if (s->top == NULL || s->used == STACK_SEG_LEN) {
+        StackSegment* seg = s->spare;
+        if (seg != NULL) {
+            s->spare = NULL;
+        } else {
+            seg = (StackSegment*) malloc(sizeof(StackSegment));
+            if (seg == NULL) {
+                return false;
+            }
+        }
+        seg->prev = s->top;
+        s->top = seg;
+        s->used = 0;
+    }
+
+    s->top->data[s->used++] = d;
+    s->size++;
+    return true;
+}
+
+/**
+ * Elimina y devuelve el elemento en la parte superior de la pila.
+ *
+ * @param s Apuntador a la pila.
+ * @return El dato extraído, o -1 si la pila está vacía o `s` es NULL.
+ * @details Si el segmento superior queda vacío se desenlaza y se guarda en spare; si spare ya
+ *          tenía un segmento, el que quedó vacío se libera.
+ */
+Data stack_seg_pop(StackSeg* s){
+    if (s == NULL || s->top == NULL) {
+        return -1;
+    }
+
+    Data d = s->top->data[--s->used];
+    s->size--;
+    if (s->used == 0) {
+        StackSegment* seg = s->top;
+        s->top = seg->prev;
+        s->used = s->top != NULL ? STACK_SEG_LEN : 0;
+        if (s->spare == NULL) {
+            s->spare = seg;
+        } else {
+            free(seg);
+        }
+    }
+    return d;
+}
+
+/**
+ * Devuelve el elemento en la parte superior de la pila sin eliminarlo.
+ *
+ * @return El dato en el top, o -1 si la pila está vacía o `s` es NULL.
+ */
+Data stack_seg_peek(StackSeg* s){
+    if (s == NULL || s->top == NULL) {
+        return -1;
+    }
+    return s->top->data[s->used - 1];
+}
+
+/**
+ * Verifica si la pila está vacía.
+ *
+ * @return 1 si la pila está vacía, 0 si no lo está. Si el puntero `s` es NULL, devuelve -1.
+ */
+int stack_seg_is_empty(StackSeg* s){
+    if (s == NULL) {
+        return -1;
+    }
+    return s->top == NULL ? 1 : 0;
+}
+
+/**
+ * Devuelve la cantidad de elementos en la pila (0 si `s` es NULL).
+ */
+long stack_seg_size(StackSeg* s){
+    return s == NULL ? 0 : s->size;
+}
+
+/**
+ * Vacía la pila, liberando todos sus segmentos salvo el guardado en spare.
+ *
+ * @param s Apuntador a la pila que se desea vaciar.
+ * @details Cuesta O(size / STACK_SEG_LEN): se libera segmento por segmento, no dato por dato.
+ */
+void stack_seg_empty(StackSeg* s){
+    if (s == NULL) {
+        return;
+    }
+    while (s->top != NULL) {
+        StackSegment* prev = s->top->prev;
+        if (s->spare == NULL) {
+            s->spare = s->top;
+        } else {
+            free(s->top);
+        }
+        s->top = prev;
+    }
+    s->used = 0;
+    s->size = 0;
+}
+
+/**
+ * Elimina la pila y libera la memoria asociada a ella.
+ *
+ * @param s Apuntador a la pila que se desea eliminar.
+ */
+void stack_seg_delete(StackSeg* s){
+    if (s == NULL) {
+        return;
+    }
+    stack_seg_empty(s);
+    free(s->spare);
+    free(s);
+}
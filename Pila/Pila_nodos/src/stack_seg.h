@@ -0,0 +1,37 @@
+#ifndef __STACK_SEG_H__
+#define __STACK_SEG_H__
+#include <stdbool.h>
+#include "node.h"
+
+// Cantidad de datos de cada segmento.
+// Puede cambiarse al compilar, por ejemplo con -DSTACK_SEG_LEN=4
+#ifndef STACK_SEG_LEN
+#define STACK_SEG_LEN 256
+#endif
+
+// Segmento de la pila: un arreglo de datos y el segmento que está debajo de él
+typedef struct StackSegment {
+    struct StackSegment* prev;
+    Data data[STACK_SEG_LEN];
+} StackSegment;
+
+// Pila segmentada: una lista enlazada de arreglos de STACK_SEG_LEN datos. push y pop trabajan
+// sobre el arreglo del segmento superior como en una pila de arreglo; solo al cruzar el borde
+// de un segmento se enlaza o se suelta uno. Crecer no copia datos y no hay capacidad máxima.
+typedef struct {
+    StackSegment* top;     // Segmento superior; NULL si la pila está vacía
+    int used;              // Datos ocupados en el segmento superior (1 .. STACK_SEG_LEN)
+    long size;             // Cantidad total de datos
+    StackSegment* spare;   // Último segmento que quedó vacío, guardado para el siguiente push
+} StackSeg;
+
+StackSeg *stack_seg_create();
+bool stack_seg_push(StackSeg*, Data);
+Data stack_seg_pop(StackSeg*);
+Data stack_seg_peek(StackSeg*);
+int stack_seg_is_empty(StackSeg*);
+long stack_seg_size(StackSeg*);
+void stack_seg_empty(StackSeg*);
+void stack_seg_delete(StackSeg*);
+
+#endif // __STACK_SEG_H__
@@ -1,5 +1,18 @@
+#define _POSIX_C_SOURCE 200112L  // fileno, lseek, ftruncate
 #include <check.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
 #include "../src/stack.h"
+#include "../src/stack_lf.h"
+#include "../src/stack_elim.h"
+#include "../src/stack_seg.h"
+
+#define LF_THREADS 4
+#define LF_OPS 100000
 
 START_TEST(test_stack_create_delete) {
     Stack *stack = stack_create();
@@ -23,6 +36,351 @@ START_TEST(test_stack_push_pop) {
 }
 END_TEST
 
+START_TEST(test_stack_node_reuse) {
+    Stack *stack = stack_create();
+
+    // Un nodo liberado por pop se reutiliza en el siguiente push
+    stack_push(stack, 10);
+    Node *first = stack->top;
+    stack_pop(stack);
+    stack_push(stack, 20);
+    ck_assert_ptr_eq(stack->top, first);
+    ck_assert_int_eq(stack_pop(stack), 20);
+    stack_delete(stack);
+}
+END_TEST
+
+#ifdef STACK_STATS
+START_TEST(test_stack_stats) {
+    Stack *stack = stack_create();
+    Data in[10] = {0};
+    Data out[10];
+
+    stack_push(stack, 1);
+    stack_push_n(stack, in, 10);
+    stack_pop_n(stack, out, 4);
+    stack_pop(stack);
+
+    StackStats st = stack_stats(stack);
+    ck_assert_uint_eq(st.pushes, 11);
+    ck_assert_uint_eq(st.pops, 5);
+    ck_assert_uint_eq(st.allocs, 11);
+    ck_assert_uint_eq(st.high_water, 11);
+    ck_assert_uint_eq(st.bytes, 6 * sizeof(Node));
+    ck_assert_uint_eq(st.rejected, 0);
+
+    stack_empty(stack);
+    st = stack_stats(stack);
+    ck_assert_uint_eq(st.pushes - st.pops, 0);
+    ck_assert_uint_eq(st.bytes, 0);
+    stack_delete(stack);
+}
+END_TEST
+#endif
+
+START_TEST(test_stack_push_pop_n) {
+    Stack *stack = stack_create();
+    Data in[1000];
+    Data out[1000];
+
+    for (int i = 0; i < 1000; i++) {
+        in[i] = i;
+    }
+    stack_push(stack, -1);
+    ck_assert_int_eq(stack_push_n(stack, in, 1000), 1000);
+    ck_assert_int_eq(stack_pop(stack), 999);
+    ck_assert_int_eq(stack_pop_n(stack, out, 999), 999);
+    for (int i = 0; i < 999; i++) {
+        ck_assert_int_eq(out[i], i);
+    }
+    ck_assert_int_eq(stack_pop_n(stack, out, 10), 1);
+    ck_assert_int_eq(out[0], -1);
+    ck_assert(stack_is_empty(stack));
+    stack_delete(stack);
+}
+END_TEST
+
+static void* lf_worker(void* arg) {
+    StackLF *stack = (StackLF*)arg;
+    long long *sum = (long long*)malloc(sizeof(long long));
+    *sum = 0;
+    for (int i = 1; i <= LF_OPS; i++) {
+        Data d;
+        stack_lf_push(stack, i);
+        if (stack_lf_pop(stack, &d)) {
+            *sum += d;
+        }
+    }
+    stack_lf_thread_exit();
+    return sum;
+}
+
+START_TEST(test_stack_lf) {
+    StackLF *stack = stack_lf_create();
+    Data d;
+
+    ck_assert(stack_lf_is_empty(stack));
+    ck_assert(!stack_lf_pop(stack, &d));
+    stack_lf_push(stack, 10);
+    stack_lf_push(stack, 20);
+    ck_assert(stack_lf_pop(stack, &d));
+    ck_assert_int_eq(d, 20);
+    ck_assert(stack_lf_pop(stack, &d));
+    ck_assert_int_eq(d, 10);
+
+    // Varios hilos haciendo push y pop: todo lo insertado se extrae exactamente una vez
+    pthread_t threads[LF_THREADS];
+    for (int t = 0; t < LF_THREADS; t++) {
+        pthread_create(&threads[t], NULL, lf_worker, stack);
+    }
+    long long total = 0;
+    for (int t = 0; t < LF_THREADS; t++) {
+        void *sum;
+        pthread_join(threads[t], &sum);
+        total += *(long long*)sum;
+        free(sum);
+    }
+    while (stack_lf_pop(stack, &d)) {
+        total += d;
+    }
+    ck_assert(total == (long long)LF_THREADS * LF_OPS * (LF_OPS + 1) / 2);
+    stack_lf_thread_exit();
+    stack_lf_delete(stack);
+}
+END_TEST
+
+static void* elim_worker(void* arg) {
+    StackElim *stack = (StackElim*)arg;
+    long long *sum = (long long*)malloc(sizeof(long long));
+    *sum = 0;
+    for (int i = 1; i <= LF_OPS; i++) {
+        Data d;
+        stack_elim_push(stack, i);
+        if (stack_elim_pop(stack, &d)) {
+            *sum += d;
+        }
+    }
+    stack_lf_thread_exit();
+    return sum;
+}
+
+START_TEST(test_stack_elim) {
+    StackElim *stack = stack_elim_create();
+    Data d;
+
+    ck_assert(!stack_elim_pop(stack, &d));
+    stack_elim_push(stack, 10);
+    stack_elim_push(stack, 20);
+    ck_assert(stack_elim_pop(stack, &d));
+    ck_assert_int_eq(d, 20);
+    ck_assert(stack_elim_pop(stack, &d));
+    ck_assert_int_eq(d, 10);
+
+    // Los datos intercambiados en el arreglo de eliminación tampoco se pierden ni se repiten
+    pthread_t threads[LF_THREADS];
+    for (int t = 0; t < LF_THREADS; t++) {
+        pthread_create(&threads[t], NULL, elim_worker, stack);
+    }
+    long long total = 0;
+    for (int t = 0; t < LF_THREADS; t++) {
+        void *sum;
+        pthread_join(threads[t], &sum);
+        total += *(long long*)sum;
+        free(sum);
+    }
+    while (stack_elim_pop(stack, &d)) {
+        total += d;
+    }
+    ck_assert(total == (long long)LF_THREADS * LF_OPS * (LF_OPS + 1) / 2);
+    stack_lf_thread_exit();
+    stack_elim_delete(stack);
+}
+END_TEST
+
+START_TEST(test_stack_seg) {
+    StackSeg *stack = stack_seg_create();
+    int n = 3 * STACK_SEG_LEN + 5;
+
+    ck_assert_int_eq(stack_seg_is_empty(stack), 1);
+    ck_assert_int_eq(stack_seg_pop(stack), -1);
+    for (int i = 0; i < n; i++) {
+        ck_assert(stack_seg_push(stack, i));
+    }
+    ck_assert_int_eq(stack_seg_size(stack), n);
+    ck_assert_int_eq(stack_seg_peek(stack), n - 1);
+
+    // Oscilar en el borde de un segmento reutiliza el segmento guardado en spare
+    while (stack_seg_size(stack) > 2 * STACK_SEG_LEN) {
+        stack_seg_pop(stack);
+    }
+    stack_seg_push(stack, 2 * STACK_SEG_LEN);
+    StackSegment *boundary = stack->top;
+    stack_seg_pop(stack);
+    ck_assert_ptr_eq(stack->spare, boundary);
+    stack_seg_push(stack, 2 * STACK_SEG_LEN);
+    ck_assert_ptr_eq(stack->top, boundary);
+    ck_assert_ptr_null(stack->spare);
+
+    for (int i = 2 * STACK_SEG_LEN; i >= 0; i--) {
+        ck_assert_int_eq(stack_seg_pop(stack), i);
+    }
+    ck_assert_int_eq(stack_seg_is_empty(stack), 1);
+
+    stack_seg_push(stack, 7);
+    stack_seg_empty(stack);
+    ck_assert_int_eq(stack_seg_size(stack), 0);
+    stack_seg_delete(stack);
+}
+END_TEST
+
+START_TEST(test_stack_arena) {
+    Arena arena;
+    arena_init(&arena);
+    Stack *stacks[8];
+
+    // Varias pilas en la misma arena; ninguna se elimina por separado
+    for (int k = 0; k < 8; k++) {
+        stacks[k] = stack_create_in(&arena);
+        ck_assert_ptr_nonnull(stacks[k]);
+        for (int i = 0; i < 1000; i++) {
+            stack_push(stacks[k], k * 1000 + i);
+        }
+    }
+    for (int k = 0; k < 8; k++) {
+        for (int i = 999; i >= 500; i--) {
+            ck_assert_int_eq(stack_pop(stacks[k]), k * 1000 + i);
+        }
+    }
+
+    // Un nodo extraído se reutiliza en el siguiente push de la misma pila
+    Node *first = stacks[0]->top;
+    stack_pop(stacks[0]);
+    stack_push(stacks[0], 42);
+    ck_assert_ptr_eq(stacks[0]->top, first);
+
+    Data out[3];
+    Data in[3] = { 1, 2, 3 };
+    ck_assert_int_eq(stack_push_n(stacks[1], in, 3), 3);
+    ck_assert_int_eq(stack_pop_n(stacks[1], out, 3), 3);
+    ck_assert_int_eq(out[2], 3);
+
+    stack_empty(stacks[2]);
+    ck_assert(stack_is_empty(stacks[2]));
+    stack_delete(stacks[3]);  // Sin efecto: la pila pertenece a la arena
+    ck_assert_int_eq(stack_pop(stacks[3]), 3499);
+
+    // Llenar y vaciar muchas veces reutiliza los mismos nodos: la arena no crece. Con pops
+    // antes de vaciar, la cadena se enlaza a los nodos que ya estaban en recycled
+    for (int i = 0; i < 1000; i++) {
+        stack_push(stacks[4], i);
+    }
+    stack_empty(stacks[4]);
+    char *cur = arena.cur;
+    ArenaBlock *blocks = arena.blocks;
+    for (int round = 0; round < 10; round++) {
+        for (int i = 0; i < 1000; i++) {
+            stack_push(stacks[4], i);
+        }
+        stack_pop(stacks[4]);
+        stack_pop(stacks[4]);
+        stack_empty(stacks[4]);
+        ck_assert(stack_is_empty(stacks[4]));
+    }
+    ck_assert_ptr_eq(arena.cur, cur);
+    ck_assert_ptr_eq(arena.blocks, blocks);
+
+    arena_release(&arena);
+    ck_assert_ptr_null(arena.blocks);
+}
+END_TEST
+
+START_TEST(test_stack_try_pop) {
+    Stack *stack = stack_create();
+    Data d = 99;
+
+    ck_assert(!stack_try_pop(stack, &d));
+    ck_assert_int_eq(d, 99);  // Sin datos, out no cambia
+
+    // -1 es un dato como cualquier otro: try_pop lo distingue de una pila vacía
+    stack_push(stack, -1);
+    stack_push(stack, 5);
+    stack_push(stack, 6);
+    ck_assert(stack_try_pop(stack, &d));
+    ck_assert_int_eq(d, 6);
+    ck_assert(stack_try_pop(stack, &d));
+    ck_assert_int_eq(d, 5);
+    ck_assert(stack_try_pop(stack, &d));
+    ck_assert_int_eq(d, -1);
+    ck_assert(!stack_try_pop(stack, &d));
+    ck_assert(stack_is_empty(stack));
+    stack_delete(stack);
+}
+END_TEST
+
+START_TEST(test_stack_io) {
+    // Más datos que un bloque de E/S (64 KiB), para recorrer varios bloques
+    enum { N = 50000 };
+    Data* in = (Data*) malloc(N * sizeof(Data));
+    for (int i = 0; i < N; i++) {
+        in[i] = i % 7 == 0 ? INT_MIN + i : (i % 2 == 0 ? -i * 40009 : i * 40009);
+    }
+    Stack* stack = stack_create();
+    ck_assert_int_eq(stack_push_n(stack, in, N), N);
+
+    // Binario: datos en crudo de la base al top; también desde una posición sin alinear
+    size_t bin_len = stack_export_bin(stack, NULL, 0);
+    ck_assert_uint_eq(bin_len, N * sizeof(Data));
+    char* bin = (char*) malloc(bin_len + 1);
+    ck_assert_uint_eq(stack_export_bin(stack, bin + 1, bin_len), bin_len);
+    ck_assert(memcmp(bin + 1, in, bin_len) == 0);
+
+    Stack* copy = stack_create();
+    ck_assert_int_eq(stack_import_bin(copy, bin + 1, bin_len), N);
+    ck_assert_int_eq(stack_import_bin(copy, bin + 1, 3), -1);
+
+    // Texto: el formato de stack_print, igual en el buffer y en el descriptor
+    size_t text_len = stack_export_text(stack, NULL, 0);
+    char* text = (char*) malloc(text_len);
+    char* written = (char*) malloc(text_len);
+    ck_assert_uint_eq(stack_export_text(stack, text, text_len), text_len);
+    ck_assert(text[text_len - 1] == '\n');
+
+    FILE* f = tmpfile();
+    ck_assert_ptr_nonnull(f);
+    ck_assert(stack_write_text(stack, fileno(f)));
+    ck_assert(lseek(fileno(f), 0, SEEK_CUR) == (off_t) text_len);
+    lseek(fileno(f), 0, SEEK_SET);
+    ck_assert(read(fileno(f), written, text_len) == (ssize_t) text_len);
+    ck_assert(memcmp(written, text, text_len) == 0);
+    ck_assert_int_eq(stack_import_text(copy, text, text_len), N);
+    ck_assert_int_eq(stack_import_text(copy, "1 -", 3), -1);  // Inválido: la pila no cambia
+
+    // Descriptor en binario: se escribe y se vuelve a leer
+    ck_assert(ftruncate(fileno(f), 0) == 0);
+    lseek(fileno(f), 0, SEEK_SET);
+    ck_assert(stack_write_bin(stack, fileno(f)));
+    lseek(fileno(f), 0, SEEK_SET);
+    ck_assert_int_eq(stack_read_bin(copy, fileno(f)), N);
+    fclose(f);
+
+    // copy tiene la pila tres veces; cada stack_pop_n devuelve los datos originales
+    Data* out = (Data*) malloc(N * sizeof(Data));
+    for (int k = 0; k < 3; k++) {
+        ck_assert_int_eq(stack_pop_n(copy, out, N), N);
+        ck_assert(memcmp(out, in, N * sizeof(Data)) == 0);
+    }
+    ck_assert(stack_is_empty(copy));
+
+    stack_delete(stack);
+    stack_delete(copy);
+    free(in);
+    free(bin);
+    free(text);
+    free(written);
+    free(out);
+}
+END_TEST
+
 Suite* stack_suite(void) {
     Suite* s;
     TCase* tc_core;
@@ -32,6 +390,17 @@ Suite* stack_suite(void) {
     tc_core = tcase_create("Core");
     tcase_add_test(tc_core, test_stack_create_delete);
     tcase_add_test(tc_core, test_stack_push_pop);
+    tcase_add_test(tc_core, test_stack_node_reuse);
+#ifdef STACK_STATS
+    tcase_add_test(tc_core, test_stack_stats);
+#endif
+    tcase_add_test(tc_core, test_stack_push_pop_n);
+    tcase_add_test(tc_core, test_stack_lf);
+    tcase_add_test(tc_core, test_stack_elim);
+    tcase_add_test(tc_core, test_stack_seg);
+    tcase_add_test(tc_core, test_stack_arena);
+    tcase_add_test(tc_core, test_stack_try_pop);
+    tcase_add_test(tc_core, test_stack_io);
     suite_add_tcase(s, tc_core);
 
     return s;
@@ -0,0 +1,258 @@
+#define _DEFAULT_SOURCE  // clock_gettime y wait4
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+/*
+ * Comparación de rendimiento de las seis variantes de Pila y Cola, más la pila segmentada
+ * de Pila_nodos.
+ *
+ * Este archivo se compila una vez por variante (ver Makefile), definiendo una de
+ * BENCH_PILA_ARREGLOS, BENCH_PILA_ARREGLOS_DINAMICOS, BENCH_PILA_NODOS, BENCH_PILA_SEGMENTADA,
+ * BENCH_COLA_ARREGLOS, BENCH_COLA_ARREGLOS_DINAMICOS o BENCH_COLA_NODOS. Cada variante se adapta a la misma
+ * interfaz mínima: b_create, b_put, b_take y b_destroy.
+ *
+ * Cargas de trabajo, todas con n elementos:
+ *   push         n inserciones sobre la estructura vacía
+ *   pop          n extracciones sobre la estructura llena (el llenado no se mide)
+ *   intercalado  n pares inserción/extracción
+ *   llenar_vaciar n inserciones seguidas de n extracciones
+ *   aleatorio    n operaciones, 50% inserción y 50% extracción al azar
+ *
+ * Cada medición corre en un proceso hijo para obtener su pico de memoria (ru_maxrss).
+ * Salida CSV: variante,carga,n,ns_por_op,ops_por_s,rss_pico_kb
+ *
+ * Uso: ./bench_<variante> [n_max]   (n = 10, 100, ..., n_max; por defecto 10^6)
+ */
+
+#if defined(BENCH_PILA_ARREGLOS)
+#include "../Pila/Pila_arreglos/src/stack.h"
+#define VARIANT "Pila_arreglos"
+#define CAPACITY MAX_SIZE
+typedef Stack Bench;
+static Bench* b_create(void) { Bench* b = malloc(sizeof(Bench)); *b = stack_create(); return b; }
+static void b_put(Bench* b, Data d) { stack_push(b, d); }
+static Data b_take(Bench* b) { return stack_pop(b); }
+static void b_destroy(Bench* b) { free(b); }
+
+#elif defined(BENCH_PILA_ARREGLOS_DINAMICOS)
+#include "../Pila/Pila_arreglos_dinamicos/src/stack.h"
+#define VARIANT "Pila_arreglos_dinamicos"
+typedef Stack Bench;
+static Bench* b_create(void) { Bench* b = malloc(sizeof(Bench)); *b = stack_create(16); return b; }
+static void b_put(Bench* b, Data d) { stack_push(b, d); }
+static Data b_take(Bench* b) { return stack_pop(b); }
+static void b_destroy(Bench* b) { stack_delete(b); free(b); }
+
+#elif defined(BENCH_PILA_NODOS)
+#include "../Pila/Pila_nodos/src/stack.h"
+#define VARIANT "Pila_nodos"
+typedef Stack Bench;
+static Bench* b_create(void) { return stack_create(); }
+static void b_put(Bench* b, Data d) { stack_push(b, d); }
+static Data b_take(Bench* b) { return stack_pop(b); }
+static void b_destroy(Bench* b) { stack_delete(b); }
+
+#elif defined(BENCH_PILA_SEGMENTADA)
+#include "../Pila/Pila_nodos/src/stack_seg.h"
+#define VARIANT "Pila_segmentada"
+typedef StackSeg Bench;
+static Bench* b_create(void) { return stack_seg_create(); }
+static void b_put(Bench* b, Data d) { stack_seg_push(b, d); }
+static Data b_take(Bench* b) { return stack_seg_pop(b); }
+static void b_destroy(Bench* b) { stack_seg_delete(b); }
+
+#elif defined(BENCH_COLA_ARREGLOS)
+#include "../Cola/Cola_arreglos/src/queue.h"
+#define VARIANT "Cola_arreglos"
+#define CAPACITY TAM
+typedef Queue Bench;
+static Bench* b_create(void) { Bench* b = malloc(sizeof(Bench)); *b = queue_create(); return b; }
+static void b_put(Bench* b, Data d) { queue_enqueue(b, d); }
+static Data b_take(Bench* b) { return queue_dequeue(b); }
+static void b_destroy(Bench* b) { free(b); }
+
+#elif defined(BENCH_COLA_ARREGLOS_DINAMICOS)
+#include "../Cola/Cola_arreglos_dinamicos/src/queue.h"
+#define VARIANT "Cola_arreglos_dinamicos"
+typedef Queue Bench;
+static Bench* b_create(void) { Bench* b = malloc(sizeof(Bench)); *b = queue_create(16); return b; }
+static void b_put(Bench* b, Data d) { queue_enqueue(b, d); }
+static Data b_take(Bench* b) { return queue_dequeue(b); }
+static void b_destroy(Bench* b) { queue_delete(b); free(b); }
+
+#elif defined(BENCH_COLA_NODOS)
+#include "../Cola/Cola_nodos/src/queue.h"
+#define VARIANT "Cola_nodos"
+typedef Queue Bench;
+static Bench* b_create(void) { return queue_create(); }
+static void b_put(Bench* b, Data d) { queue_enqueue(b, d); }
+static Data b_take(Bench* b) { return queue_dequeue(b); }
+static void b_destroy(Bench* b) { queue_delete(b); }
+
+#else
+#error "Define la variante a medir, por ejemplo -DBENCH_PILA_NODOS"
+#endif
+
+// Las mediciones con n pequeño se repiten hasta completar al menos este número de operaciones
+#define MIN_OPS 1000000L
+
+typedef enum { W_PUSH, W_POP, W_INTERLEAVED, W_FILL_DRAIN, W_RANDOM, W_COUNT } Workload;
+
+static const char* workload_names[W_COUNT] = { "push", "pop", "intercalado", "llenar_vaciar", "aleatorio" };
+
+static volatile Data sink;  // Evita que el compilador descarte las extracciones
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * Ejecuta una vez la carga de trabajo sobre una estructura nueva.
+ * 
+ * @param ops Se incrementa con el número de operaciones medidas.
+ * @return Los segundos medidos.
+ */
+static double run_once(Workload w, long n, long* ops) {
+    Bench* b = b_create();
+    Data acc = 0;
+    double start, elapsed;
+
+    switch (w) {
+    case W_PUSH:
+        start = now();
+        for (long i = 0; i < n; i++) {
+            b_put(b, (Data)i);
+        }
+        elapsed = now() - start;
+        *ops += n;
+        break;
+    case W_POP:
+        for (long i = 0; i < n; i++) {
+            b_put(b, (Data)i);
+        }
+        start = now();
+        for (long i = 0; i < n; i++) {
+            acc += b_take(b);
+        }
+        elapsed = now() - start;
+        *ops += n;
+        break;
+    case W_INTERLEAVED:
+        start = now();
+        for (long i = 0; i < n; i++) {
+            b_put(b, (Data)i);
+            acc += b_take(b);
+        }
+        elapsed = now() - start;
+        *ops += 2 * n;
+        break;
+    case W_FILL_DRAIN:
+        start = now();
+        for (long i = 0; i < n; i++) {
+            b_put(b, (Data)i);
+        }
+        for (long i = 0; i < n; i++) {
+            acc += b_take(b);
+        }
+        elapsed = now() - start;
+        *ops += 2 * n;
+        break;
+    default: {
+        uint32_t rng = 2463534242u;
+        long size = 0;
+        start = now();
+        for (long i = 0; i < n; i++) {
+            rng ^= rng << 13;
+            rng ^= rng >> 17;
+            rng ^= rng << 5;
+#ifdef CAPACITY
+            int put = (rng & 1) ? size < CAPACITY : size == 0;
+#else
+            int put = (rng & 1) || size == 0;
+#endif
+            if (put) {
+                b_put(b, (Data)i);
+                size++;
+            } else {
+                acc += b_take(b);
+                size--;
+            }
+        }
+        elapsed = now() - start;
+        *ops += n;
+        break;
+    }
+    }
+    sink = acc;
+    b_destroy(b);
+    return elapsed;
+}
+
+/**
+ * Mide una combinación de carga y tamaño en un proceso hijo e imprime su fila CSV.
+ */
+static void measure(Workload w, long n) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        perror("pipe");
+        exit(1);
+    }
+    pid_t pid = fork();
+    if (pid == 0) {
+        close(fds[0]);
+        long ops = 0;
+        double elapsed = 0;
+        long reps = n < MIN_OPS ? MIN_OPS / n : 1;
+        for (long r = 0; r < reps; r++) {
+            elapsed += run_once(w, n, &ops);
+        }
+        double ns_per_op = elapsed * 1e9 / ops;
+        if (write(fds[1], &ns_per_op, sizeof(ns_per_op)) != sizeof(ns_per_op)) {
+            _exit(1);
+        }
+        _exit(0);
+    }
+    close(fds[1]);
+
+    double ns_per_op = 0;
+    int status;
+    struct rusage usage;
+    ssize_t got = read(fds[0], &ns_per_op, sizeof(ns_per_op));
+    close(fds[0]);
+    wait4(pid, &status, 0, &usage);
+    if (got != sizeof(ns_per_op) || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        fprintf(stderr, "%s: falló la medición %s n=%ld\n", VARIANT, workload_names[w], n);
+        return;
+    }
+    printf("%s,%s,%ld,%.2f,%.0f,%ld\n", VARIANT, workload_names[w], n, ns_per_op,
+           1e9 / ns_per_op, usage.ru_maxrss);
+    fflush(stdout);
+}
+
+int main(int argc, char** argv) {
+    long max_n = argc > 1 ? atol(argv[1]) : 1000000;
+    if (argc > 2 && strcmp(argv[2], "--header") == 0) {
+        printf("variante,carga,n,ns_por_op,ops_por_s,rss_pico_kb\n");
+    }
+    for (long n = 10; n <= max_n; n *= 10) {
+#ifdef CAPACITY
+        if (n > CAPACITY) {
+            break;  // La variante tiene capacidad fija; no tiene sentido medir más elementos
+        }
+#endif
+        for (Workload w = W_PUSH; w < W_COUNT; w++) {
+            measure(w, n);
+        }
+    }
+    return 0;
+}